@@ -0,0 +1,325 @@
+/*******************************************************************************
+* File Name:   app_boot.c
+
+* Description: Provides the boot phase profiler and the deferred
+*              initialization of non-critical peripherals.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "app_boot.h"
+#include "app_log.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define APP_BOOT_CYCLES_PER_US    (SystemCoreClock / 1000000UL)
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Reason for the current boot */
+static app_boot_type_t boot_type = APP_BOOT_COLD;
+
+/* Initialization steps postponed until the first idle point */
+static app_boot_task_t boot_deferred[APP_BOOT_MAX_DEFERRED];
+static uint8_t boot_deferred_count = 0;
+
+#if (APP_BOOT_PROFILE_ENABLE)
+/* DWT cycle count at the end of each phase, valid if its bit is set */
+static uint32_t boot_phase_cycles[APP_BOOT_PHASE_COUNT];
+static uint32_t boot_phase_valid = 0;
+
+/* Report header for each boot type */
+static const app_log_token_t boot_type_tokens[] =
+{
+    LOG_BOOT_PROFILE_COLD,
+    LOG_BOOT_PROFILE_HIBERNATE,
+    LOG_BOOT_PROFILE_WARM,
+};
+
+/* Report line for each boot phase */
+static const app_log_token_t boot_phase_tokens[APP_BOOT_PHASE_COUNT] =
+{
+    LOG_BOOT_PHASE_WARM_SYSINIT,
+    LOG_BOOT_PHASE_WARM_SMIF,
+    LOG_BOOT_PHASE_WARM_CYCFG,
+    LOG_BOOT_PHASE_WARM_NVIC,
+    LOG_BOOT_PHASE_WARM_CALLBACKS,
+    LOG_BOOT_PHASE_BSP_INIT,
+    LOG_BOOT_PHASE_GPIO_INIT,
+    LOG_BOOT_PHASE_IRQ_CONFIG,
+    LOG_BOOT_PHASE_DSRAM_INIT,
+    LOG_BOOT_PHASE_FIRST_IDLE,
+    LOG_BOOT_PHASE_UART_INIT,
+    LOG_BOOT_PHASE_BANNER,
+};
+#endif /* APP_BOOT_PROFILE_ENABLE */
+
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: app_boot_start
+********************************************************************************
+* Summary:
+*  Resets the boot record and starts the DWT cycle counter. RAM is retained
+*  across DS-RAM, so the record must be cleared explicitly on every boot.
+*  On a warm boot the counter is started earlier, with APP_BOOT_COUNTER_START()
+*  at the top of the warm boot handler, and is left running here.
+*
+* Parameters:
+*  type - reason for the current boot
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_boot_start(app_boot_type_t type)
+{
+    boot_type = type;
+    boot_deferred_count = 0;
+
+#if (APP_BOOT_PROFILE_ENABLE)
+    boot_phase_valid = 0;
+    if (APP_BOOT_WARM != type)
+    {
+        APP_BOOT_COUNTER_START();
+    }
+#endif /* APP_BOOT_PROFILE_ENABLE */
+}
+
+
+/*******************************************************************************
+* Function Name: app_boot_mark
+********************************************************************************
+* Summary:
+*  Records the end of a boot phase. Only the first mark of a phase is kept.
+*
+* Parameters:
+*  phase - boot phase that has completed
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_boot_mark(app_boot_phase_t phase)
+{
+    app_boot_record(phase, APP_BOOT_CYCLES());
+}
+
+
+/*******************************************************************************
+* Function Name: app_boot_record
+********************************************************************************
+* Summary:
+*  Records the end of a boot phase from a cycle count taken earlier with
+*  APP_BOOT_CYCLES(), for phases that complete before app_boot_start() can
+*  be called. Only the first record of a phase is kept.
+*
+* Parameters:
+*  phase - boot phase that has completed
+*  cycles - cycle count at the end of the phase
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_boot_record(app_boot_phase_t phase, uint32_t cycles)
+{
+#if (APP_BOOT_PROFILE_ENABLE)
+    if ((phase < APP_BOOT_PHASE_COUNT) &&
+        (0U == (boot_phase_valid & (1UL << phase))))
+    {
+        boot_phase_cycles[phase] = cycles;
+        boot_phase_valid |= (1UL << phase);
+    }
+#else
+    CY_UNUSED_PARAMETER(phase);
+    CY_UNUSED_PARAMETER(cycles);
+#endif /* APP_BOOT_PROFILE_ENABLE */
+}
+
+
+/*******************************************************************************
+* Function Name: app_boot_get_type
+********************************************************************************
+* Summary:
+*  Returns the reason for the current boot
+*
+* Parameters:
+*  void
+*
+* Return:
+*  app_boot_type_t
+*
+*******************************************************************************/
+app_boot_type_t app_boot_get_type(void)
+{
+    return boot_type;
+}
+
+
+/*******************************************************************************
+* Function Name: app_boot_defer
+********************************************************************************
+* Summary:
+*  Queues an initialization step to run at the first idle point, just before
+*  the main loop first enters a low-power mode
+*
+* Parameters:
+*  task - initialization step to be deferred
+*
+* Return:
+*  cy_rslt_t CY_RSLT_SUCCESS, or APP_BOOT_RSLT_ERR_DEFER if the queue is
+*  full
+*
+*******************************************************************************/
+cy_rslt_t app_boot_defer(app_boot_task_t task)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if ((NULL == task) || (boot_deferred_count >= APP_BOOT_MAX_DEFERRED))
+    {
+        result = APP_BOOT_RSLT_ERR_DEFER;
+    }
+    else
+    {
+        boot_deferred[boot_deferred_count++] = task;
+    }
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: app_boot_run_deferred
+********************************************************************************
+* Summary:
+*  Runs the deferred initialization steps in the order they were queued and
+*  empties the queue. Execution stops at the first step that fails.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t result of the first failing step, or CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t app_boot_run_deferred(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint8_t index;
+
+    for (index = 0; (index < boot_deferred_count) &&
+                    (CY_RSLT_SUCCESS == result); index++)
+    {
+        result = boot_deferred[index]();
+    }
+    boot_deferred_count = 0;
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: app_boot_deferred_pending
+********************************************************************************
+* Summary:
+*  Returns true while deferred initialization steps are waiting to run
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool
+*
+*******************************************************************************/
+bool app_boot_deferred_pending(void)
+{
+    return (0U != boot_deferred_count);
+}
+
+
+/*******************************************************************************
+* Function Name: app_boot_report
+********************************************************************************
+* Summary:
+*  Prints the time at which each recorded phase completed, measured from
+*  app_boot_start(), along with the time spent in the phase itself
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_boot_report(void)
+{
+#if (APP_BOOT_PROFILE_ENABLE)
+    uint32_t cycles_per_us = APP_BOOT_CYCLES_PER_US;
+    uint32_t previous = 0;
+    uint32_t phase;
+
+    if (0U == cycles_per_us)
+    {
+        cycles_per_us = 1U;
+    }
+
+    APP_LOG(boot_type_tokens[boot_type], (uint32_t)SystemCoreClock);
+
+    for (phase = 0; phase < APP_BOOT_PHASE_COUNT; phase++)
+    {
+        if (0U != (boot_phase_valid & (1UL << phase)))
+        {
+            APP_LOG(boot_phase_tokens[phase],
+                    boot_phase_cycles[phase] / cycles_per_us,
+                    (boot_phase_cycles[phase] - previous) / cycles_per_us);
+            previous = boot_phase_cycles[phase];
+        }
+    }
+#endif /* APP_BOOT_PROFILE_ENABLE */
+}
+
+
+/* [] END OF FILE */
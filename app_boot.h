@@ -0,0 +1,129 @@
+/*******************************************************************************
+* File Name:   app_boot.h
+
+* Description: Provides the function definitions for the boot phase profiler
+*              and the deferred initialization of non-critical peripherals
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef APP_BOOT_H_
+#define APP_BOOT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cyhal.h"
+#include "cybsp.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 0 to remove the phase timestamps and the boot report */
+#ifndef APP_BOOT_PROFILE_ENABLE
+#define APP_BOOT_PROFILE_ENABLE   (1U)
+#endif
+
+/* Maximum number of initialization steps that can be deferred */
+#define APP_BOOT_MAX_DEFERRED     (4U)
+
+/* Starts the DWT cycle counter from zero. Safe to use before the external
+ * flash is available, as it expands to register accesses only. */
+#if (APP_BOOT_PROFILE_ENABLE)
+#define APP_BOOT_COUNTER_START()                                              \
+    do                                                                        \
+    {                                                                         \
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;                       \
+        DWT->CYCCNT = 0;                                                      \
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                                  \
+    } while (0)
+#define APP_BOOT_CYCLES()         (DWT->CYCCNT)
+#else
+#define APP_BOOT_COUNTER_START()  do { } while (0)
+#define APP_BOOT_CYCLES()         (0UL)
+#endif /* APP_BOOT_PROFILE_ENABLE */
+
+/* Returned by app_boot_defer() when the step cannot be queued */
+#define APP_BOOT_RSLT_ERR_DEFER   (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, \
+                                   CY_RSLT_MODULE_MIDDLEWARE_BASE, 0U))
+
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+/* Reason the application entered main() */
+typedef enum
+{
+    APP_BOOT_COLD = 0U,         /* Power-on or external reset */
+    APP_BOOT_HIBERNATE,         /* Wake from Hibernate */
+    APP_BOOT_WARM,              /* Wake from DeepSleep-RAM */
+} app_boot_type_t;
+
+/* Boot phases, in the order they are expected to complete */
+typedef enum
+{
+    APP_BOOT_PHASE_WARM_SYSINIT = 0U,   /* Warm boot: SystemInit_Warmboot */
+    APP_BOOT_PHASE_WARM_SMIF,       /* Warm boot: SMIF enable and init */
+    APP_BOOT_PHASE_WARM_CYCFG,      /* Warm boot: init_cycfg_all() */
+    APP_BOOT_PHASE_WARM_NVIC,       /* Warm boot: NVIC restore */
+    APP_BOOT_PHASE_WARM_CALLBACKS,  /* Warm boot: DS-RAM AFTER callbacks */
+    APP_BOOT_PHASE_BSP_INIT,        /* cybsp_init() or warm boot release */
+    APP_BOOT_PHASE_GPIO_INIT,       /* User LED and button initialization */
+    APP_BOOT_PHASE_IRQ_CONFIG,      /* Button callbacks and interrupts */
+    APP_BOOT_PHASE_DSRAM_INIT,      /* DS-RAM entry point and callbacks */
+    APP_BOOT_PHASE_FIRST_IDLE,      /* First low-power entry of the loop */
+    APP_BOOT_PHASE_UART_INIT,       /* Deferred retarget-io bring-up */
+    APP_BOOT_PHASE_BANNER,          /* Deferred banner printing */
+    APP_BOOT_PHASE_COUNT
+} app_boot_phase_t;
+
+/* Deferred initialization step */
+typedef cy_rslt_t (*app_boot_task_t)(void);
+
+
+/*******************************************************************************
+* Function Declarations
+*******************************************************************************/
+void app_boot_start(app_boot_type_t type);
+void app_boot_mark(app_boot_phase_t phase);
+void app_boot_record(app_boot_phase_t phase, uint32_t cycles);
+app_boot_type_t app_boot_get_type(void);
+cy_rslt_t app_boot_defer(app_boot_task_t task);
+cy_rslt_t app_boot_run_deferred(void);
+bool app_boot_deferred_pending(void);
+void app_boot_report(void);
+
+
+#endif /* APP_BOOT_H_ */
@@ -44,11 +44,29 @@
 * Header Files
 *******************************************************************************/
 #include "app_dsram.h"
+#include "app_boot.h"
+#if (APP_DSRAM_TRACE_ENABLE)
+#include "app_log.h"
+#endif /* APP_DSRAM_TRACE_ENABLE */
 
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
+#if (APP_DSRAM_TRACE_ENABLE)
+/* Counts a HAL or PDL call made by a callback */
+#define CY_APP_TRACE_CALL(trace)  ((trace)->hal_calls++)
+
+/* Reconfigures a pin parked by a callback and tracks it */
+#define CY_APP_GPIO_CONFIGURE(trace, pin, direction, drive_mode)              \
+    cy_app_gpio_configure((trace), (pin), (direction), (drive_mode))
+#else
+#define CY_APP_TRACE_CALL(trace)
+
+/* Without tracing, the callbacks call the HAL directly */
+#define CY_APP_GPIO_CONFIGURE(trace, pin, direction, drive_mode)              \
+    (void)cyhal_gpio_configure((pin), (direction), (drive_mode))
+#endif /* APP_DSRAM_TRACE_ENABLE */
 
 
 /*******************************************************************************
@@ -61,11 +79,34 @@ uint8_t warm_boot = 0;
 cy_stc_syspm_warmboot_entrypoint_t syspm_app_dsram_entry_point =
 {(uint32_t *)&__INITIAL_SP, (uint32_t *)&cy_app_warmboot_handler};
 
+#if (APP_DSRAM_TRACE_ENABLE)
+/* Transition statistics of the DS and DS-RAM callbacks, retained in DS-RAM */
+static cy_app_syspm_trace_t ds_trace;
+static cy_app_syspm_trace_t dsram_trace;
+
+/* Pins parked by the callbacks, bit n of parked_mask is cy_app_parked_pins[n] */
+static const cyhal_gpio_t cy_app_parked_pins[] =
+{
+    CYBSP_BT_UART_RTS,
+    CYBSP_BT_UART_CTS
+};
+#endif /* APP_DSRAM_TRACE_ENABLE */
+
 
 /*******************************************************************************
 * Function Prototypes
 *******************************************************************************/
 extern int main(void);
+#if (APP_DSRAM_TRACE_ENABLE)
+static uint32_t cy_app_trace_begin(cy_app_syspm_trace_t *trace,
+                                   cy_en_syspm_callback_mode_t mode);
+static void cy_app_trace_end(cy_app_syspm_trace_t *trace,
+                             cy_en_syspm_callback_mode_t mode, uint32_t start);
+static void cy_app_gpio_configure(cy_app_syspm_trace_t *trace,
+                                  cyhal_gpio_t pin,
+                                  cyhal_gpio_direction_t direction,
+                                  cyhal_gpio_drive_mode_t drive_mode);
+#endif /* APP_DSRAM_TRACE_ENABLE */
 
 
 /*******************************************************************************
@@ -88,19 +129,35 @@ extern int main(void);
 CY_SECTION_RAMFUNC_BEGIN
 int  cy_app_warmboot_handler(void)
 {
+    uint32_t sysinit_cycles;
+    uint32_t smif_cycles;
+
+    /* The flash is not available until SMIF is up: only register accesses
+     * are used to time the first phases */
+    APP_BOOT_COUNTER_START();
+
     warm_boot=1;
     SystemInit_Warmboot_CAT1B_CM33();
+    sysinit_cycles = APP_BOOT_CYCLES();
 
     cybsp_smif_enable();
     cybsp_smif_init();
+    smif_cycles = APP_BOOT_CYCLES();
+
+    app_boot_start(APP_BOOT_WARM);
+    app_boot_record(APP_BOOT_PHASE_WARM_SYSINIT, sysinit_cycles);
+    app_boot_record(APP_BOOT_PHASE_WARM_SMIF, smif_cycles);
 
     init_cycfg_all();
+    app_boot_mark(APP_BOOT_PHASE_WARM_CYCFG);
 
     System_Restore_NVIC_Reg();
+    app_boot_mark(APP_BOOT_PHASE_WARM_NVIC);
 
     /* Suppress a compiler warning about unused return value */
     (void)Cy_SysPm_ExecuteCallback(((cy_en_syspm_callback_type_t)
                             CY_SYSPM_DEEPSLEEP_RAM), CY_SYSPM_AFTER_TRANSITION);
+    app_boot_mark(APP_BOOT_PHASE_WARM_CALLBACKS);
 
     /* Desired Resume point of the application */
     main();
@@ -108,6 +165,151 @@ int  cy_app_warmboot_handler(void)
 }
 CY_SECTION_RAMFUNC_END
 
+#if (APP_DSRAM_TRACE_ENABLE)
+/*******************************************************************************
+* Function Name: cy_app_trace_begin
+********************************************************************************
+* Summary:
+*  Checks the order of the callback modes and starts timing the callback body.
+*  The cycle counter is started here if it is not running: the DS-RAM
+*  AFTER_TRANSITION callback runs from the warm boot handler, before main()
+*  and independently of APP_BOOT_PROFILE_ENABLE.
+*
+* Parameters:
+*  trace - statistics of the callback
+*  mode - callback mode being executed
+*
+* Return:
+*  uint32_t cycle count at the start of the callback
+*
+*******************************************************************************/
+static uint32_t cy_app_trace_begin(cy_app_syspm_trace_t *trace,
+                                   cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t start;
+
+    if (0U == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    start = DWT->CYCCNT;
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        trace->in_transition = true;
+    }
+    else if ((CY_SYSPM_AFTER_TRANSITION == mode) && !trace->in_transition)
+    {
+        trace->order_errors++;
+    }
+    return start;
+}
+
+
+/*******************************************************************************
+* Function Name: cy_app_trace_end
+********************************************************************************
+* Summary:
+*  Records the duration of the callback body and, at the end of a transition,
+*  checks that every pin changed before the transition has been restored
+*
+* Parameters:
+*  trace - statistics of the callback
+*  mode - callback mode being executed
+*  start - value returned by cy_app_trace_begin()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cy_app_trace_end(cy_app_syspm_trace_t *trace,
+                             cy_en_syspm_callback_mode_t mode, uint32_t start)
+{
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    if (cycles > trace->max_cycles)
+    {
+        trace->max_cycles = cycles;
+    }
+
+    if (CY_SYSPM_AFTER_TRANSITION == mode)
+    {
+        /* Count each pin still parked */
+        for (uint32_t pins = trace->parked_mask; 0U != pins; pins &= pins - 1U)
+        {
+            trace->pin_errors++;
+        }
+        trace->parked_mask = 0;
+        trace->in_transition = false;
+        trace->transitions++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cy_app_gpio_configure
+********************************************************************************
+* Summary:
+*  Reconfigures a pin from a callback and keeps track of the pins that are in
+*  the low-power (analog) configuration. Parking a pin twice or restoring a
+*  pin that is not parked is counted as a pin error.
+*
+* Parameters:
+*  trace - statistics of the callback
+*  pin - pin to be reconfigured
+*  direction - new pin direction
+*  drive_mode - new pin drive mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cy_app_gpio_configure(cy_app_syspm_trace_t *trace,
+                                  cyhal_gpio_t pin,
+                                  cyhal_gpio_direction_t direction,
+                                  cyhal_gpio_drive_mode_t drive_mode)
+{
+    uint32_t pin_bit = 0;
+
+    cyhal_gpio_configure(pin, direction, drive_mode);
+    CY_APP_TRACE_CALL(trace);
+
+    for (uint32_t i = 0; i < (sizeof(cy_app_parked_pins) /
+                              sizeof(cy_app_parked_pins[0])); i++)
+    {
+        if (pin == cy_app_parked_pins[i])
+        {
+            pin_bit = 1UL << i;
+        }
+    }
+
+    if (0U == pin_bit)
+    {
+        /* Pin missing from cy_app_parked_pins */
+        trace->pin_errors++;
+    }
+    else if (CYHAL_GPIO_DRIVE_ANALOG == drive_mode)
+    {
+        if (0U != (trace->parked_mask & pin_bit))
+        {
+            trace->pin_errors++;
+        }
+        trace->parked_mask |= pin_bit;
+    }
+    else
+    {
+        if (0U == (trace->parked_mask & pin_bit))
+        {
+            /* Restored a pin that was never parked */
+            trace->pin_errors++;
+        }
+        trace->parked_mask &= ~pin_bit;
+    }
+}
+#endif /* APP_DSRAM_TRACE_ENABLE */
+
+
 /*******************************************************************************
 * Function Name: cy_app_ds_callback
 ********************************************************************************
@@ -126,6 +328,9 @@ cy_en_syspm_status_t cy_app_ds_callback(cy_stc_syspm_callback_params_t*
 callbackParams,cy_en_syspm_callback_mode_t mode)
 {
     cy_en_syspm_status_t retVal = CY_SYSPM_FAIL;
+#if (APP_DSRAM_TRACE_ENABLE)
+    uint32_t start = cy_app_trace_begin(&ds_trace, mode);
+#endif /* APP_DSRAM_TRACE_ENABLE */
 
     CY_UNUSED_PARAMETER(callbackParams);
 
@@ -147,12 +352,12 @@ callbackParams,cy_en_syspm_callback_mode_t mode)
         {
             /* CTS and RTS pins are configured as analog hign-z as it is
              * connected to kitprog3 and also drawing more current */
-            cyhal_gpio_configure(CYBSP_BT_UART_RTS,
-                                CYHAL_GPIO_DIR_INPUT,
-                                CYHAL_GPIO_DRIVE_ANALOG);
-            cyhal_gpio_configure(CYBSP_BT_UART_CTS,
-                                 CYHAL_GPIO_DIR_INPUT,
-                                 CYHAL_GPIO_DRIVE_ANALOG);
+            CY_APP_GPIO_CONFIGURE(&ds_trace, CYBSP_BT_UART_RTS,
+                                  CYHAL_GPIO_DIR_INPUT,
+                                  CYHAL_GPIO_DRIVE_ANALOG);
+            CY_APP_GPIO_CONFIGURE(&ds_trace, CYBSP_BT_UART_CTS,
+                                  CYHAL_GPIO_DIR_INPUT,
+                                  CYHAL_GPIO_DRIVE_ANALOG);
 
             retVal = CY_SYSPM_SUCCESS;
         break;
@@ -168,18 +373,22 @@ callbackParams,cy_en_syspm_callback_mode_t mode)
         case CY_SYSPM_AFTER_TRANSITION:
         {
             /* CTS and RTS pins are configured to it's default configuration */
-            cyhal_gpio_configure(CYBSP_BT_UART_RTS,
-                                 CYHAL_GPIO_DIR_OUTPUT,
-                                 CYHAL_GPIO_DRIVE_PULL_NONE);
-            cyhal_gpio_configure(CYBSP_BT_UART_CTS,
-                                 CYHAL_GPIO_DIR_OUTPUT,
-                                 CYHAL_GPIO_DRIVE_PULL_NONE);
+            CY_APP_GPIO_CONFIGURE(&ds_trace, CYBSP_BT_UART_RTS,
+                                  CYHAL_GPIO_DIR_OUTPUT,
+                                  CYHAL_GPIO_DRIVE_PULL_NONE);
+            CY_APP_GPIO_CONFIGURE(&ds_trace, CYBSP_BT_UART_CTS,
+                                  CYHAL_GPIO_DIR_OUTPUT,
+                                  CYHAL_GPIO_DRIVE_PULL_NONE);
             retVal = CY_SYSPM_SUCCESS;
             break;
         }
         default:
         break;
     }
+
+#if (APP_DSRAM_TRACE_ENABLE)
+    cy_app_trace_end(&ds_trace, mode, start);
+#endif /* APP_DSRAM_TRACE_ENABLE */
     return retVal;
 }
 
@@ -201,6 +410,9 @@ cy_en_syspm_status_t cy_app_dsram_callback(cy_stc_syspm_callback_params_t*
 callbackParams,cy_en_syspm_callback_mode_t mode)
 {
     cy_en_syspm_status_t retVal = CY_SYSPM_FAIL;
+#if (APP_DSRAM_TRACE_ENABLE)
+    uint32_t start = cy_app_trace_begin(&dsram_trace, mode);
+#endif /* APP_DSRAM_TRACE_ENABLE */
 
     CY_UNUSED_PARAMETER(callbackParams);
 
@@ -222,11 +434,14 @@ callbackParams,cy_en_syspm_callback_mode_t mode)
         {
             /* CTS and RTS pins are configured as analog hign-z as it is
              * connected to kitprog3 and also drawing more current */
-            cyhal_gpio_configure(CYBSP_BT_UART_RTS, CYHAL_GPIO_DIR_INPUT,
-                                                    CYHAL_GPIO_DRIVE_ANALOG);
-            cyhal_gpio_configure(CYBSP_BT_UART_CTS, CYHAL_GPIO_DIR_INPUT,
-                                                    CYHAL_GPIO_DRIVE_ANALOG);
+            CY_APP_GPIO_CONFIGURE(&dsram_trace, CYBSP_BT_UART_RTS,
+                                  CYHAL_GPIO_DIR_INPUT,
+                                  CYHAL_GPIO_DRIVE_ANALOG);
+            CY_APP_GPIO_CONFIGURE(&dsram_trace, CYBSP_BT_UART_CTS,
+                                  CYHAL_GPIO_DIR_INPUT,
+                                  CYHAL_GPIO_DRIVE_ANALOG);
             System_Store_NVIC_Reg();
+            CY_APP_TRACE_CALL(&dsram_trace);
             retVal = CY_SYSPM_SUCCESS;
         break;
         }
@@ -241,18 +456,22 @@ callbackParams,cy_en_syspm_callback_mode_t mode)
         case CY_SYSPM_AFTER_TRANSITION:
         {
             /* CTS and RTS pins are configured to it's default configuration */
-            cyhal_gpio_configure(CYBSP_BT_UART_RTS,
-                                 CYHAL_GPIO_DIR_OUTPUT,
-                                 CYHAL_GPIO_DRIVE_PULL_NONE);
-            cyhal_gpio_configure(CYBSP_BT_UART_CTS,
-                                 CYHAL_GPIO_DIR_OUTPUT,
-                                 CYHAL_GPIO_DRIVE_PULL_NONE);
+            CY_APP_GPIO_CONFIGURE(&dsram_trace, CYBSP_BT_UART_RTS,
+                                  CYHAL_GPIO_DIR_OUTPUT,
+                                  CYHAL_GPIO_DRIVE_PULL_NONE);
+            CY_APP_GPIO_CONFIGURE(&dsram_trace, CYBSP_BT_UART_CTS,
+                                  CYHAL_GPIO_DIR_OUTPUT,
+                                  CYHAL_GPIO_DRIVE_PULL_NONE);
             retVal = CY_SYSPM_SUCCESS;
             break;
         }
         default:
         break;
     }
+
+#if (APP_DSRAM_TRACE_ENABLE)
+    cy_app_trace_end(&dsram_trace, mode, start);
+#endif /* APP_DSRAM_TRACE_ENABLE */
     return retVal;
 }
 
@@ -348,3 +567,56 @@ cy_rslt_t cybsp_syspm_dsram_init(void)
 
      return CY_RSLT_SUCCESS;
 }
+
+
+/*******************************************************************************
+* Function Name: cy_app_syspm_init
+********************************************************************************
+* Summary:
+*  Sets the DS-RAM warm boot entry point, then registers the DS-RAM and DS
+*  callbacks. Registration is repeated on every warm boot, so its result is
+*  not checked.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t result of cybsp_syspm_dsram_init()
+*
+*******************************************************************************/
+cy_rslt_t cy_app_syspm_init(void)
+{
+    cy_rslt_t result = cybsp_syspm_dsram_init();
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        (void)cy_app_register_syspm_dsram_callback();
+        (void)cy_app_register_syspm_ds_callback();
+    }
+    return result;
+}
+
+#if (APP_DSRAM_TRACE_ENABLE)
+/*******************************************************************************
+* Function Name: cy_app_syspm_trace_report
+********************************************************************************
+* Summary:
+*  Prints the transition statistics of the DS and DS-RAM callbacks
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cy_app_syspm_trace_report(void)
+{
+    APP_LOG(LOG_SYSPM_TRACE_DS, ds_trace.transitions, ds_trace.hal_calls,
+            ds_trace.order_errors + ds_trace.pin_errors, ds_trace.max_cycles);
+    APP_LOG(LOG_SYSPM_TRACE_DSRAM, dsram_trace.transitions,
+            dsram_trace.hal_calls,
+            dsram_trace.order_errors + dsram_trace.pin_errors,
+            dsram_trace.max_cycles);
+}
+#endif /* APP_DSRAM_TRACE_ENABLE */
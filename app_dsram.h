@@ -49,6 +49,32 @@
 #include "cybsp_smif_init.h"
 
 
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to count the work done by the DS and DS-RAM callbacks and to check
+ * that every transition restores what it changed */
+#ifndef APP_DSRAM_TRACE_ENABLE
+#define APP_DSRAM_TRACE_ENABLE    (0U)
+#endif
+
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Per-callback transition statistics */
+typedef struct
+{
+    uint32_t transitions;   /* Completed BEFORE/AFTER transition pairs */
+    uint32_t hal_calls;     /* HAL and PDL calls made by the callback */
+    uint32_t order_errors;  /* AFTER_TRANSITION without BEFORE_TRANSITION */
+    uint32_t pin_errors;    /* Pins left in the low-power configuration */
+    uint32_t max_cycles;    /* Longest callback body, in CPU cycles */
+    uint32_t parked_mask;   /* Pins currently in the low-power configuration */
+    bool in_transition;     /* BEFORE_TRANSITION seen, AFTER_TRANSITION due */
+} cy_app_syspm_trace_t;
+
+
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
@@ -66,6 +92,10 @@ cy_rslt_t cy_app_register_syspm_dsram_callback(void);
 cy_rslt_t cy_app_register_syspm_ds_callback(void);
 int cy_app_warmboot_handler(void);
 cy_rslt_t cybsp_syspm_dsram_init(void);
+cy_rslt_t cy_app_syspm_init(void);
+#if (APP_DSRAM_TRACE_ENABLE)
+void cy_app_syspm_trace_report(void);
+#endif /* APP_DSRAM_TRACE_ENABLE */
 
 
 #endif /* APP_DSRAM_H_ */
@@ -0,0 +1,756 @@
+/*******************************************************************************
+* File Name:   app_input.c
+
+* Description: Decodes short, long, double and chord presses of the user
+*              buttons. A press edge wakes the device once; the edge
+*              interrupts are then masked, so that contact bounce does not
+*              cause further wakeups, and one LPTimer sample at the long
+*              press deadline tells a short press from a long one. Buttons
+*              with double press decoding also take a debounce sample and
+*              wait for a second press edge until the deadline.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "app_input.h"
+#include "app_log.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define APP_INPUT_IRQ_PRIORITY    (2UL)
+
+/* LPTimer runs from the 32.768 kHz LFCLK */
+#define APP_INPUT_LFCLK_HZ        (32768UL)
+#define APP_INPUT_MS_TO_TICKS(ms) (((ms) * APP_INPUT_LFCLK_HZ) / 1000UL)
+
+#define APP_INPUT_BTN_ALL         (APP_INPUT_BTN1 | APP_INPUT_BTN2)
+
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+typedef enum
+{
+    INPUT_IDLE = 0U,            /* Waiting for a press edge */
+    INPUT_PRESSED,              /* Press edge seen, no double press decoded:
+                                 * waiting for the long press deadline */
+    INPUT_DEBOUNCE,             /* Press edge seen with double press decoded,
+                                 * waiting for the sample */
+    INPUT_WAIT_SECOND,          /* Press confirmed, waiting for a second press
+                                 * or the long press deadline */
+    INPUT_HELD,                 /* Long press reported, waiting for the
+                                 * release edge */
+    INPUT_RELEASE,              /* Edge seen while held, waiting for the
+                                 * sample */
+} app_input_state_t;
+
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t gestures;          /* Gestures reported */
+    uint32_t edge_wakeups;      /* Button edge interrupts */
+    uint32_t timer_wakeups;     /* Debounce and deadline interrupts */
+    uint32_t rejected;          /* Press edges with no press at the sample */
+    uint32_t press_wakeups;     /* Edge interrupts on a press (falling edge) */
+    uint32_t masked_edges;      /* Bounces latched while masked */
+} app_input_stats_t;
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static cyhal_lptimer_t input_timer;
+static bool input_timer_ready = false;
+
+static cyhal_gpio_callback_data_t btn1_cb;
+static cyhal_gpio_callback_data_t btn2_cb;
+
+static app_input_handler_t input_handler;
+static uint8_t input_double_mask;
+
+/* Gesture in progress */
+static volatile app_input_state_t input_state = INPUT_IDLE;
+static uint8_t input_buttons;
+static uint8_t input_presses;
+static uint32_t input_press_tick;
+static bool input_edges_masked;
+
+static app_input_stats_t input_stats;
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void app_input_edges_mask(void);
+static void app_input_edges_unmask(cyhal_gpio_event_t event);
+static uint8_t app_input_edges_latched(void);
+static uint32_t app_input_count(uint8_t buttons);
+static void app_input_schedule(uint32_t ticks);
+static void app_input_schedule_long(void);
+static void app_input_hold(void);
+static void app_input_finish(void);
+static void app_input_emit(app_input_gesture_t gesture);
+static uint8_t app_input_read(void);
+static void app_input_edge_handler(void *handler_arg, cyhal_gpio_event_t event);
+static void app_input_timer_handler(void *handler_arg,
+                                    cyhal_lptimer_event_t event);
+
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: app_input_init
+********************************************************************************
+* Summary:
+*  Registers the button edge interrupts and initializes the LPTimer used to
+*  sample the buttons. The buttons must already be initialized as inputs.
+*
+* Parameters:
+*  handler - called with each decoded gesture
+*  double_mask - buttons for which double presses are decoded, see
+*                app_input_set_double()
+*
+* Return:
+*  cy_rslt_t
+*
+*******************************************************************************/
+cy_rslt_t app_input_init(app_input_handler_t handler, uint8_t double_mask)
+{
+    cy_rslt_t result;
+
+    input_handler = handler;
+    input_double_mask = double_mask;
+    input_state = INPUT_IDLE;
+    input_stats = (app_input_stats_t){ 0 };
+
+    result = cyhal_lptimer_init(&input_timer);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        input_timer_ready = true;
+        cyhal_lptimer_register_callback(&input_timer, &app_input_timer_handler,
+                                        NULL);
+
+        btn1_cb.callback = &app_input_edge_handler;
+        btn1_cb.callback_arg = (void *)(uintptr_t)APP_INPUT_BTN1;
+        cyhal_gpio_register_callback(CYBSP_USER_BTN, &btn1_cb);
+
+        btn2_cb.callback = &app_input_edge_handler;
+        btn2_cb.callback_arg = (void *)(uintptr_t)APP_INPUT_BTN2;
+        cyhal_gpio_register_callback(CYBSP_USER_BTN2, &btn2_cb);
+
+        input_edges_masked = true;
+        app_input_edges_unmask(CYHAL_GPIO_IRQ_FALL);
+    }
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_free
+********************************************************************************
+* Summary:
+*  Releases the LPTimer. Required before app_input_init() after a warm boot
+*  because the HAL state is retained in DS-RAM.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_input_free(void)
+{
+    if (input_timer_ready)
+    {
+        cyhal_lptimer_free(&input_timer);
+        input_timer_ready = false;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_busy
+********************************************************************************
+* Summary:
+*  Returns true while a gesture is being decoded
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool
+*
+*******************************************************************************/
+bool app_input_busy(void)
+{
+    return (INPUT_IDLE != input_state);
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_set_double
+********************************************************************************
+* Summary:
+*  Selects the buttons for which double presses are decoded, from the next
+*  press on. A press of such a button is confirmed by a debounce sample and
+*  the edge interrupts stay enabled until the long press deadline to catch a
+*  second press. A press of any other button only takes the sample at the
+*  long press deadline.
+*
+* Parameters:
+*  double_mask - APP_INPUT_BTN1 and/or APP_INPUT_BTN2, or 0
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_input_set_double(uint8_t double_mask)
+{
+    input_double_mask = double_mask;
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_report
+********************************************************************************
+* Summary:
+*  Prints the number of gestures and of the wakeups spent decoding them, and
+*  compares them with the wakeups an interrupt on every falling edge would
+*  have taken, in total and per gesture. The GPIO interrupt status only
+*  latches whether a masked pin had an edge, so each pin with a latched edge
+*  at a debounce sample counts as one falling edge; longer bounces are
+*  undercounted.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_input_report(void)
+{
+    uint32_t wakeups = input_stats.edge_wakeups + input_stats.timer_wakeups;
+    uint32_t baseline = input_stats.press_wakeups + input_stats.masked_edges;
+    uint32_t gestures = (0U != input_stats.gestures) ? input_stats.gestures : 1U;
+
+    APP_LOG(LOG_INPUT_STATS, input_stats.gestures, input_stats.edge_wakeups,
+            input_stats.timer_wakeups, input_stats.rejected);
+    APP_LOG(LOG_INPUT_WAKEUPS, wakeups, baseline);
+
+    /* Hundredths of a wakeup per gesture */
+    wakeups = (wakeups * 100U) / gestures;
+    baseline = (baseline * 100U) / gestures;
+    APP_LOG(LOG_INPUT_PER_GESTURE, wakeups / 100U, wakeups % 100U,
+            baseline / 100U, baseline % 100U);
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_edges_mask
+********************************************************************************
+* Summary:
+*  Masks the edge interrupts of both buttons. Edge detection stays enabled on
+*  both edges, so that the edges seen while masked are latched in the GPIO
+*  interrupt status and can be read by app_input_edges_latched().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_edges_mask(void)
+{
+    if (!input_edges_masked)
+    {
+        cyhal_gpio_enable_event(CYBSP_USER_BTN, CYHAL_GPIO_IRQ_BOTH,
+                                APP_INPUT_IRQ_PRIORITY, false);
+        cyhal_gpio_enable_event(CYBSP_USER_BTN2, CYHAL_GPIO_IRQ_BOTH,
+                                APP_INPUT_IRQ_PRIORITY, false);
+        input_edges_masked = true;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_edges_unmask
+********************************************************************************
+* Summary:
+*  Enables the given edge interrupt of both buttons and clears the edges
+*  latched while they were masked
+*
+* Parameters:
+*  event - CYHAL_GPIO_IRQ_FALL to wait for a press, CYHAL_GPIO_IRQ_BOTH to
+*          wait for a release or a press of the other button
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_edges_unmask(cyhal_gpio_event_t event)
+{
+    cyhal_gpio_enable_event(CYBSP_USER_BTN, event, APP_INPUT_IRQ_PRIORITY,
+                            true);
+    cyhal_gpio_enable_event(CYBSP_USER_BTN2, event, APP_INPUT_IRQ_PRIORITY,
+                            true);
+    input_edges_masked = false;
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_edges_latched
+********************************************************************************
+* Summary:
+*  Returns the buttons with an edge latched since the edge interrupts were
+*  masked. The edge that caused the wakeup is cleared when masking, so a
+*  latched edge is a bounce, a release or a new press.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t button bits
+*
+*******************************************************************************/
+static uint8_t app_input_edges_latched(void)
+{
+    uint8_t latched = 0;
+
+    if (0U != Cy_GPIO_GetInterruptStatus(
+                  Cy_GPIO_PortToAddr(CYHAL_GET_PORT(CYBSP_USER_BTN)),
+                  CYHAL_GET_PIN(CYBSP_USER_BTN)))
+    {
+        latched |= APP_INPUT_BTN1;
+    }
+    if (0U != Cy_GPIO_GetInterruptStatus(
+                  Cy_GPIO_PortToAddr(CYHAL_GET_PORT(CYBSP_USER_BTN2)),
+                  CYHAL_GET_PIN(CYBSP_USER_BTN2)))
+    {
+        latched |= APP_INPUT_BTN2;
+    }
+    return latched;
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_count
+********************************************************************************
+* Summary:
+*  Returns the number of buttons in a button mask
+*
+* Parameters:
+*  buttons - button bits
+*
+* Return:
+*  uint32_t 0 to 2
+*
+*******************************************************************************/
+static uint32_t app_input_count(uint8_t buttons)
+{
+    return ((0U != (buttons & APP_INPUT_BTN1)) ? 1U : 0U) +
+           ((0U != (buttons & APP_INPUT_BTN2)) ? 1U : 0U);
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_schedule
+********************************************************************************
+* Summary:
+*  Arms the LPTimer to interrupt once after the given delay
+*
+* Parameters:
+*  ticks - delay in LPTimer ticks
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_schedule(uint32_t ticks)
+{
+    cyhal_lptimer_set_delay(&input_timer, ticks);
+    cyhal_lptimer_enable_event(&input_timer, CYHAL_LPTIMER_COMPARE_MATCH,
+                               APP_INPUT_IRQ_PRIORITY, true);
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_schedule_long
+********************************************************************************
+* Summary:
+*  Arms the LPTimer for the long press deadline of the press in progress
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_schedule_long(void)
+{
+    uint32_t held = cyhal_lptimer_read(&input_timer) - input_press_tick;
+
+    if (held < APP_INPUT_MS_TO_TICKS(APP_INPUT_LONG_MS))
+    {
+        app_input_schedule(APP_INPUT_MS_TO_TICKS(APP_INPUT_LONG_MS) - held);
+    }
+    else
+    {
+        /* Deadline already passed during a bounce */
+        app_input_schedule(1U);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_hold
+********************************************************************************
+* Summary:
+*  Long press reported: waits for the release edge, so that the bounce of
+*  the release is not taken as a new press
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_hold(void)
+{
+    input_state = INPUT_HELD;
+    cyhal_lptimer_enable_event(&input_timer, CYHAL_LPTIMER_COMPARE_MATCH,
+                               APP_INPUT_IRQ_PRIORITY, false);
+    app_input_edges_unmask(CYHAL_GPIO_IRQ_BOTH);
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_finish
+********************************************************************************
+* Summary:
+*  Ends the gesture: stops the LPTimer and waits for the next press edge
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_finish(void)
+{
+    cyhal_lptimer_enable_event(&input_timer, CYHAL_LPTIMER_COMPARE_MATCH,
+                               APP_INPUT_IRQ_PRIORITY, false);
+    input_state = INPUT_IDLE;
+    app_input_edges_mask();
+    app_input_edges_unmask(CYHAL_GPIO_IRQ_FALL);
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_emit
+********************************************************************************
+* Summary:
+*  Reports a gesture to the handler. A press that involved both buttons is
+*  always reported as a chord.
+*
+* Parameters:
+*  gesture - decoded gesture
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_emit(app_input_gesture_t gesture)
+{
+    if (APP_INPUT_BTN_ALL == input_buttons)
+    {
+        gesture = APP_INPUT_CHORD;
+    }
+    input_stats.gestures++;
+    if (NULL != input_handler)
+    {
+        input_handler(gesture, input_buttons);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_read
+********************************************************************************
+* Summary:
+*  Returns the buttons that are currently pressed
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t button bits
+*
+*******************************************************************************/
+static uint8_t app_input_read(void)
+{
+    uint8_t buttons = 0;
+
+    if (CYBSP_BTN_PRESSED == cyhal_gpio_read(CYBSP_USER_BTN))
+    {
+        buttons |= APP_INPUT_BTN1;
+    }
+    if (CYBSP_BTN_PRESSED == cyhal_gpio_read(CYBSP_USER_BTN2))
+    {
+        buttons |= APP_INPUT_BTN2;
+    }
+    return buttons;
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_edge_handler
+********************************************************************************
+* Summary:
+*  Button edge: a press starts a gesture or is a second press, an edge while
+*  a long press is held is its release. The edges are masked until the next
+*  sample so that bounce does not wake the device again.
+*
+*  Without double press decoding, a press is only sampled at the long press
+*  deadline, so a press edge with the button already released when the
+*  interrupt runs is rejected as a glitch here.
+*
+* Parameters:
+*  void *handler_arg - button bit
+*  cyhal_gpio_event_t event
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_edge_handler(void *handler_arg, cyhal_gpio_event_t event)
+{
+    uint8_t button = (uint8_t)(uintptr_t)handler_arg;
+
+    (void)event;
+
+    /* Only falling edges are enabled unless a long press is held, then an
+     * edge of a button that is not held is a press */
+    input_stats.edge_wakeups++;
+    if ((INPUT_HELD != input_state) || (0U == (input_buttons & button)))
+    {
+        input_stats.press_wakeups++;
+    }
+    app_input_edges_mask();
+
+    switch (input_state)
+    {
+        case INPUT_IDLE:
+            input_buttons = button;
+            input_presses = 0;
+            input_press_tick = cyhal_lptimer_read(&input_timer);
+            if (0U != (button & input_double_mask))
+            {
+                input_state = INPUT_DEBOUNCE;
+                app_input_schedule(APP_INPUT_MS_TO_TICKS(APP_INPUT_SAMPLE_MS));
+            }
+            else if (0U != (app_input_read() & button))
+            {
+                /* One sample at the deadline decides short or long */
+                input_state = INPUT_PRESSED;
+                app_input_schedule_long();
+            }
+            else
+            {
+                input_stats.rejected++;
+                app_input_finish();
+            }
+            break;
+        case INPUT_WAIT_SECOND:
+            input_state = INPUT_DEBOUNCE;
+            app_input_schedule(APP_INPUT_MS_TO_TICKS(APP_INPUT_SAMPLE_MS));
+            break;
+        case INPUT_HELD:
+            input_state = INPUT_RELEASE;
+            app_input_schedule(APP_INPUT_MS_TO_TICKS(APP_INPUT_SAMPLE_MS));
+            break;
+        default:
+            break;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: app_input_timer_handler
+********************************************************************************
+* Summary:
+*  LPTimer interrupt: takes the debounce sample after an edge, or decides
+*  between a short and a long press at the long press deadline
+*
+* Parameters:
+*  void *handler_arg
+*  cyhal_lptimer_event_t event
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_input_timer_handler(void *handler_arg,
+                                    cyhal_lptimer_event_t event)
+{
+    uint8_t pressed;
+    uint8_t latched;
+
+    (void)handler_arg;
+    (void)event;
+
+    input_stats.timer_wakeups++;
+    pressed = app_input_read();
+
+    switch (input_state)
+    {
+        case INPUT_PRESSED:
+            /* Long press deadline, the edges have been masked since the
+             * press. A latched edge of the other button is a press of it;
+             * the edges of the pressed button are its bounce and release. */
+            latched = app_input_edges_latched() & (uint8_t)~input_buttons;
+            input_stats.masked_edges += app_input_count(latched);
+            input_buttons |= latched;
+            if (0U != pressed)
+            {
+                input_buttons |= pressed;
+                app_input_emit(APP_INPUT_LONG);
+                app_input_hold();
+            }
+            else
+            {
+                app_input_emit(APP_INPUT_SHORT);
+                app_input_finish();
+            }
+            break;
+
+        case INPUT_WAIT_SECOND:
+            /* Long press deadline without a second press */
+            if (0U != pressed)
+            {
+                input_buttons |= pressed;
+                app_input_emit(APP_INPUT_LONG);
+                app_input_edges_mask();
+                app_input_hold();
+            }
+            else
+            {
+                app_input_emit(APP_INPUT_SHORT);
+                app_input_finish();
+            }
+            break;
+
+        case INPUT_RELEASE:
+            /* Debounce sample after an edge while a long press is held */
+            input_stats.masked_edges +=
+                app_input_count(app_input_edges_latched());
+            if (0U != pressed)
+            {
+                app_input_hold();
+            }
+            else
+            {
+                app_input_finish();
+            }
+            break;
+
+        default:
+            /* Debounce sample after a press edge. A latched edge is a
+             * bounce, which includes a falling edge, unless the press was a
+             * glitch. */
+            if (0U != pressed)
+            {
+                input_stats.masked_edges +=
+                    app_input_count(app_input_edges_latched());
+            }
+
+            if ((0U != pressed) && (0U == input_presses))
+            {
+                /* First press confirmed, a second press wakes the device
+                 * before the long press deadline */
+                input_buttons |= pressed;
+                input_presses = 1;
+                input_state = INPUT_WAIT_SECOND;
+                app_input_edges_unmask(CYHAL_GPIO_IRQ_FALL);
+                app_input_schedule_long();
+            }
+            else if (0U != pressed)
+            {
+                /* Second press, reported as a chord if it is a press of
+                 * the other button. Its release is a rising edge and does
+                 * not wake the device. */
+                input_buttons |= pressed;
+                app_input_emit(APP_INPUT_DOUBLE);
+                app_input_finish();
+            }
+            else if (0U == input_presses)
+            {
+                /* Bounce or glitch */
+                input_stats.rejected++;
+                app_input_finish();
+            }
+            else
+            {
+                /* Bounce of the first release or a second press too short
+                 * to count, keep waiting for the deadline */
+                input_state = INPUT_WAIT_SECOND;
+                app_input_edges_unmask(CYHAL_GPIO_IRQ_FALL);
+                app_input_schedule_long();
+            }
+            break;
+    }
+}
+
+
+/* [] END OF FILE */
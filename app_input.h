@@ -0,0 +1,101 @@
+/*******************************************************************************
+* File Name:   app_input.h
+
+* Description: Provides the function definitions for the user button
+*              gesture engine
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef APP_INPUT_H_
+#define APP_INPUT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cyhal.h"
+#include "cybsp.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Button bits reported with a gesture */
+#define APP_INPUT_BTN1            (0x01U)
+#define APP_INPUT_BTN2            (0x02U)
+
+/* Debounce time: the buttons are sampled once this long after an edge */
+#ifndef APP_INPUT_SAMPLE_MS
+#define APP_INPUT_SAMPLE_MS       (50U)
+#endif
+
+/* Hold time after which a press is reported as long. A short press is
+ * reported at this deadline, and a second press before it makes a double
+ * press. */
+#ifndef APP_INPUT_LONG_MS
+#define APP_INPUT_LONG_MS         (800U)
+#endif
+
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+typedef enum
+{
+    APP_INPUT_SHORT = 0U,       /* Single press shorter than the long time */
+    APP_INPUT_LONG,             /* Press held for the long time */
+    APP_INPUT_DOUBLE,           /* Two presses within the double press time */
+    APP_INPUT_CHORD,            /* Both buttons pressed together */
+} app_input_gesture_t;
+
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Called from interrupt context when a gesture has been decoded */
+typedef void (*app_input_handler_t)(app_input_gesture_t gesture,
+                                    uint8_t buttons);
+
+
+/*******************************************************************************
+* Function Declarations
+*******************************************************************************/
+cy_rslt_t app_input_init(app_input_handler_t handler, uint8_t double_mask);
+void app_input_free(void);
+bool app_input_busy(void);
+void app_input_set_double(uint8_t double_mask);
+void app_input_report(void);
+
+
+#endif /* APP_INPUT_H_ */
@@ -0,0 +1,335 @@
+/*******************************************************************************
+* File Name:   app_log.c
+
+* Description: Provides the text and the tokenized back-ends of the
+*              application log.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include "app_log.h"
+#include "cy_retarget_io.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* A 32-bit value needs at most 5 bytes as a varint */
+#define APP_LOG_VARINT_MAX        (5U)
+
+/* Sync byte, token and arguments */
+#define APP_LOG_FRAME_MAX         (1U + (APP_LOG_VARINT_MAX * \
+                                         (1U + APP_LOG_MAX_ARGS)))
+
+/* FNV-1a, folded over 32-bit values */
+#define APP_LOG_HASH_SEED         (2166136261U)
+#define APP_LOG_HASH_PRIME        (16777619U)
+
+#define APP_LOG_TOKEN_ARGC(name, argc, fmt)   (argc),
+#define APP_LOG_TOKEN_SIZE(name, argc, fmt)   (uint16_t)sizeof(fmt),
+#define APP_LOG_TOKEN_FMT(name, argc, fmt)    fmt,
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Output is dropped until the debug UART has been initialized */
+static bool app_log_ready = false;
+
+#if (APP_LOG_TOKENIZED)
+/* Number of arguments of each token */
+static const uint8_t app_log_argc[LOG_TOKEN_COUNT] =
+{
+    APP_LOG_TOKEN_LIST(APP_LOG_TOKEN_ARGC)
+};
+
+/* Size of each format string including the terminator. Only the size is
+ * kept, so the strings themselves stay out of the image. */
+static const uint16_t app_log_size[LOG_TOKEN_COUNT] =
+{
+    APP_LOG_TOKEN_LIST(APP_LOG_TOKEN_SIZE)
+};
+#else
+/* Format string of each token */
+static const char * const app_log_fmt[LOG_TOKEN_COUNT] =
+{
+    APP_LOG_TOKEN_LIST(APP_LOG_TOKEN_FMT)
+};
+#endif /* APP_LOG_TOKENIZED */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if (APP_LOG_TOKENIZED)
+static uint32_t app_log_put_varint(uint8_t *buf, uint32_t value);
+static void app_log_write(const uint8_t *buf, size_t len);
+static uint32_t app_log_dict_hash(void);
+static void app_log_send_dict(void);
+#endif /* APP_LOG_TOKENIZED */
+
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#if (APP_LOG_TOKENIZED)
+/*******************************************************************************
+* Function Name: app_log_put_varint
+********************************************************************************
+* Summary:
+*  Encodes a value as a LEB128 varint, 7 bits per byte, least significant
+*  group first
+*
+* Parameters:
+*  buf - destination, at least APP_LOG_VARINT_MAX bytes
+*  value - value to be encoded
+*
+* Return:
+*  uint32_t number of bytes written
+*
+*******************************************************************************/
+static uint32_t app_log_put_varint(uint8_t *buf, uint32_t value)
+{
+    uint32_t len = 0;
+
+    while (value >= 0x80U)
+    {
+        buf[len++] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+    }
+    buf[len++] = (uint8_t)value;
+    return len;
+}
+
+
+/*******************************************************************************
+* Function Name: app_log_write
+********************************************************************************
+* Summary:
+*  Sends a frame on the debug UART. cyhal_uart_write() only queues what fits
+*  in the TX FIFO, so each byte is sent with the blocking cyhal_uart_putc(),
+*  as retarget-io does, and a frame is never truncated.
+*
+* Parameters:
+*  buf - frame to be sent
+*  len - number of bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_log_write(const uint8_t *buf, size_t len)
+{
+    size_t index;
+
+    for (index = 0; index < len; index++)
+    {
+        if (CY_RSLT_SUCCESS != cyhal_uart_putc(&cy_retarget_io_uart_obj,
+                                               buf[index]))
+        {
+            break;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: app_log_dict_hash
+********************************************************************************
+* Summary:
+*  Hashes the token count and the argument count and format string size of
+*  every token. tools/log_decode.py computes the same hash from
+*  app_log_tokens.h to detect a capture taken with another dictionary.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t dictionary hash
+*
+*******************************************************************************/
+static uint32_t app_log_dict_hash(void)
+{
+    uint32_t hash = (APP_LOG_HASH_SEED ^ (uint32_t)LOG_TOKEN_COUNT) *
+                    APP_LOG_HASH_PRIME;
+    uint32_t token;
+
+    for (token = 0; token < (uint32_t)LOG_TOKEN_COUNT; token++)
+    {
+        hash = (hash ^ app_log_argc[token]) * APP_LOG_HASH_PRIME;
+        hash = (hash ^ app_log_size[token]) * APP_LOG_HASH_PRIME;
+    }
+    return hash;
+}
+
+
+/*******************************************************************************
+* Function Name: app_log_send_dict
+********************************************************************************
+* Summary:
+*  Sends the dictionary frame that identifies the token dictionary
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_log_send_dict(void)
+{
+    uint8_t frame[1U + (2U * APP_LOG_VARINT_MAX)];
+    size_t len = 0;
+
+    frame[len++] = APP_LOG_FRAME_DICT;
+    len += app_log_put_varint(&frame[len], (uint32_t)LOG_TOKEN_COUNT);
+    len += app_log_put_varint(&frame[len], app_log_dict_hash());
+    app_log_write(frame, len);
+}
+#endif /* APP_LOG_TOKENIZED */
+
+
+/*******************************************************************************
+* Function Name: app_log_enable
+********************************************************************************
+* Summary:
+*  Enables the log once retarget-io is initialized, or disables it before
+*  retarget-io is released. Messages logged while disabled are dropped. In
+*  tokenized mode, enabling the log sends the dictionary frame.
+*
+* Parameters:
+*  enable - true if the debug UART is available
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_log_enable(bool enable)
+{
+    app_log_ready = enable;
+
+#if (APP_LOG_TOKENIZED)
+    if (enable)
+    {
+        app_log_send_dict();
+    }
+#endif /* APP_LOG_TOKENIZED */
+}
+
+
+/*******************************************************************************
+* Function Name: app_log_emit
+********************************************************************************
+* Summary:
+*  Sends a binary log frame on the debug UART: the sync byte, the token and
+*  each argument as varints. Does nothing unless APP_LOG_TOKENIZED is set.
+*
+* Parameters:
+*  token - log token
+*  ... - uint32_t arguments, as many as the token declares
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_log_emit(app_log_token_t token, ...)
+{
+#if (APP_LOG_TOKENIZED)
+    uint8_t frame[APP_LOG_FRAME_MAX];
+    size_t len = 0;
+    uint8_t index;
+    va_list args;
+
+    if (app_log_ready && (token < LOG_TOKEN_COUNT))
+    {
+        frame[len++] = APP_LOG_FRAME_SYNC;
+        len += app_log_put_varint(&frame[len], (uint32_t)token);
+
+        va_start(args, token);
+        for (index = 0; index < app_log_argc[token]; index++)
+        {
+            len += app_log_put_varint(&frame[len], va_arg(args, uint32_t));
+        }
+        va_end(args);
+
+        app_log_write(frame, len);
+    }
+#else
+    CY_UNUSED_PARAMETER(token);
+#endif /* APP_LOG_TOKENIZED */
+}
+
+
+/*******************************************************************************
+* Function Name: app_log_printf
+********************************************************************************
+* Summary:
+*  Prints the format string of a token through retarget-io. Does nothing when
+*  APP_LOG_TOKENIZED is set.
+*
+* Parameters:
+*  token - log token
+*  ... - uint32_t arguments, as many as the token declares
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_log_printf(app_log_token_t token, ...)
+{
+#if (APP_LOG_TOKENIZED)
+    CY_UNUSED_PARAMETER(token);
+#else
+    va_list args;
+
+    if (app_log_ready && (token < LOG_TOKEN_COUNT))
+    {
+        va_start(args, token);
+        (void)vprintf(app_log_fmt[token], args);
+        va_end(args);
+    }
+#endif /* APP_LOG_TOKENIZED */
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* File Name:   app_log.h
+
+* Description: Provides the function definitions for the application log.
+*              Messages are identified by tokens from app_log_tokens.h and
+*              are either printed as text or sent as compact binary frames.
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef APP_LOG_H_
+#define APP_LOG_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cyhal.h"
+#include "app_log_tokens.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to send binary log frames instead of text. The format strings are
+ * then left out of the image and tools/log_decode.py restores the text. */
+#ifndef APP_LOG_TOKENIZED
+#define APP_LOG_TOKENIZED         (0U)
+#endif
+
+/* First byte of every binary log frame */
+#define APP_LOG_FRAME_SYNC        (0xC0U)
+
+/* First byte of the dictionary frame sent when the log is enabled: token
+ * count and dictionary hash as varints */
+#define APP_LOG_FRAME_DICT        (0xC1U)
+
+/* Maximum number of arguments of a single log token */
+#define APP_LOG_MAX_ARGS          (4U)
+
+/* Log a message. Arguments must be uint32_t values. */
+#if (APP_LOG_TOKENIZED)
+#define APP_LOG(...)              app_log_emit(__VA_ARGS__)
+#else
+#define APP_LOG(...)              app_log_printf(__VA_ARGS__)
+#endif
+
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+#define APP_LOG_TOKEN_ENUM(name, argc, fmt)   name,
+
+/* Log tokens, numbered in dictionary order */
+typedef enum
+{
+    APP_LOG_TOKEN_LIST(APP_LOG_TOKEN_ENUM)
+    LOG_TOKEN_COUNT
+} app_log_token_t;
+
+#undef APP_LOG_TOKEN_ENUM
+
+
+/*******************************************************************************
+* Function Declarations
+*******************************************************************************/
+void app_log_enable(bool enable);
+void app_log_emit(app_log_token_t token, ...);
+void app_log_printf(app_log_token_t token, ...);
+
+
+#endif /* APP_LOG_H_ */
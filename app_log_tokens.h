@@ -0,0 +1,131 @@
+/*******************************************************************************
+* File Name:   app_log_tokens.h
+
+* Description: Log token dictionary. Each entry gives the token name, the
+*              number of 32-bit arguments and the format string. The token
+*              value is the position of the entry in the list, so new entries
+*              must be appended to keep existing logs decodable. The host
+*              decoder (tools/log_decode.py) parses this file directly.
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef APP_LOG_TOKENS_H_
+#define APP_LOG_TOKENS_H_
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* X(token, argument count, format string) */
+#define APP_LOG_TOKEN_LIST(X)                                                  \
+    X(LOG_BANNER, 0,                                                           \
+        "\x1b[2J\x1b[;H"                                                       \
+        "**********CYW20829 : Switching Power Modes*************\r\n\n"        \
+        "=========================================================\r\n"        \
+        "| Press the User Button:                                |\r\n"        \
+        "|   Press User Button 1 to Change Power mode            |\r\n"        \
+        "|   Press User Button 2 to change power system          |\r\n"        \
+        "=========================================================\r\n")       \
+    X(LOG_WARMBOOT, 0,                                                         \
+        "\n Warmboot(Wake from DS-RAM) : Running "                             \
+        "CYW20829 : Switching Power Modes Application\r\n"                     \
+        "\n Entering to Hibernate press User Button 1 to come out "            \
+        "the system from Hibernate mode\r\n")                                  \
+    X(LOG_HIBERNATE_WAKE, 0,                                                   \
+        "\n Coldboot(Wake from Hibernate) : Running"                           \
+        " CYW20829 : Switching Power Modes Application\r\n")                   \
+    X(LOG_SYSTEM_LP, 0,                                                        \
+        "\n Switching the System Power system : LP \r\n")                      \
+    X(LOG_SYSTEM_ULP, 0,                                                       \
+        "\n Switching the System Power system : ULP \r\n")                     \
+    X(LOG_SLEEP_ENTER, 0,                                                      \
+        "\n Going to Sleep : Running"                                          \
+        " CYW20829 : Switching Power Modes Application\r\n")                   \
+    X(LOG_SLEEP_WAKE, 0,                                                       \
+        "\n Wake from Sleep : Running"                                         \
+        " CYW20829 : Switching Power Modes Application\r\n")                   \
+    X(LOG_DEEPSLEEP_WAKE, 0,                                                   \
+        "\n Wake from Deep Sleep : Running"                                    \
+        " CYW20829 : Switching Power Modes Application\r\n")                   \
+    X(LOG_BOOT_PROFILE_COLD, 1,                                                \
+        "\n Boot profile : Coldboot, %lu Hz\r\n")                              \
+    X(LOG_BOOT_PROFILE_HIBERNATE, 1,                                           \
+        "\n Boot profile : Coldboot(Wake from Hibernate), %lu Hz\r\n")         \
+    X(LOG_BOOT_PROFILE_WARM, 1,                                                \
+        "\n Boot profile : Warmboot(Wake from DS-RAM), %lu Hz\r\n")            \
+    X(LOG_BOOT_PHASE_BSP_INIT, 2,                                              \
+        "   bsp_init   : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_GPIO_INIT, 2,                                             \
+        "   gpio_init  : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_IRQ_CONFIG, 2,                                            \
+        "   irq_config : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_DSRAM_INIT, 2,                                            \
+        "   dsram_init : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_FIRST_IDLE, 2,                                            \
+        "   first_idle : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_UART_INIT, 2,                                             \
+        "   uart_init  : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_BANNER, 2,                                                \
+        "   banner     : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_HIBERNATE_RESUME_LP, 1,                                              \
+        "\n Resume from Hibernate #%lu : LP\r\n")                              \
+    X(LOG_HIBERNATE_RESUME_ULP, 1,                                             \
+        "\n Resume from Hibernate #%lu : ULP\r\n")                             \
+    X(LOG_SYSPM_TRACE_DS, 4,                                                   \
+        "\n DS callback     : %lu transitions, %lu HAL calls, "                \
+        "%lu errors, %lu cycles max\r\n")                                      \
+    X(LOG_SYSPM_TRACE_DSRAM, 4,                                                \
+        "\n DS-RAM callback : %lu transitions, %lu HAL calls, "                \
+        "%lu errors, %lu cycles max\r\n")                                      \
+    X(LOG_INPUT_STATS, 4,                                                      \
+        "\n Input : %lu gestures, %lu edge wakeups, %lu timer wakeups, "       \
+        "%lu rejected\r\n")                                                    \
+    X(LOG_INPUT_WAKEUPS, 2,                                                    \
+        "\n Input : %lu wakeups, about %lu with one per press edge\r\n")       \
+    X(LOG_BOOT_PHASE_WARM_SYSINIT, 2,                                          \
+        "   sysinit    : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_WARM_SMIF, 2,                                             \
+        "   smif       : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_WARM_CYCFG, 2,                                            \
+        "   cycfg      : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_WARM_NVIC, 2,                                             \
+        "   nvic       : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_BOOT_PHASE_WARM_CALLBACKS, 2,                                        \
+        "   callbacks  : %8lu us (+%lu us)\r\n")                               \
+    X(LOG_INPUT_PER_GESTURE, 4,                                                \
+        "\n Input : %lu.%02lu wakeups per gesture, "                           \
+        "%lu.%02lu with one per press edge\r\n")
+
+
+#endif /* APP_LOG_TOKENS_H_ */
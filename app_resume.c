@@ -0,0 +1,169 @@
+/*******************************************************************************
+* File Name:   app_resume.c
+
+* Description: Saves a small checksummed application context to the backup
+*              registers before Hibernate and restores it on wakeup.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "app_resume.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Context word layout */
+#define APP_RESUME_MAGIC          (0xA5UL)
+#define APP_RESUME_MAGIC_POS      (24U)
+#define APP_RESUME_COUNT_POS      (16U)
+#define APP_RESUME_MODE_POS       (8U)
+#define APP_RESUME_FLAG_ULP       (0x01UL)
+
+/* Checksum seed, different from the register reset value */
+#define APP_RESUME_CHECKSUM_SEED  (0x5A5A5A5AUL)
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t app_resume_checksum(uint32_t word);
+
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: app_resume_checksum
+********************************************************************************
+* Summary:
+*  Computes the checksum word stored along with the context word
+*
+* Parameters:
+*  word - context word
+*
+* Return:
+*  uint32_t checksum
+*
+*******************************************************************************/
+static uint32_t app_resume_checksum(uint32_t word)
+{
+    uint32_t sum = APP_RESUME_CHECKSUM_SEED ^ word;
+
+    /* Spread every bit of the word over the checksum */
+    sum ^= sum >> 16;
+    sum *= 0x45D9F3BUL;
+    sum ^= sum >> 16;
+    return sum;
+}
+
+
+/*******************************************************************************
+* Function Name: app_resume_save
+********************************************************************************
+* Summary:
+*  Writes the context to the backup registers. Call just before entering
+*  Hibernate.
+*
+* Parameters:
+*  ctx - context to be saved
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_resume_save(const app_resume_ctx_t *ctx)
+{
+    uint32_t words[APP_RESUME_BREG_COUNT];
+
+    words[0] = (APP_RESUME_MAGIC << APP_RESUME_MAGIC_POS) |
+               ((uint32_t)ctx->hibernate_count << APP_RESUME_COUNT_POS) |
+               ((uint32_t)ctx->power_mode << APP_RESUME_MODE_POS) |
+               (ctx->ulp ? APP_RESUME_FLAG_ULP : 0UL);
+    words[1] = app_resume_checksum(words[0]);
+
+    Cy_SysPm_BackupWordStore(APP_RESUME_BREG_INDEX, words,
+                             APP_RESUME_BREG_COUNT);
+}
+
+
+/*******************************************************************************
+* Function Name: app_resume_restore
+********************************************************************************
+* Summary:
+*  Reads and validates the context saved before Hibernate. The context is
+*  invalidated so that it is used for a single wakeup only.
+*
+* Parameters:
+*  ctx - filled with the saved context if it is valid
+*
+* Return:
+*  true if a valid context was found, false otherwise
+*
+*******************************************************************************/
+bool app_resume_restore(app_resume_ctx_t *ctx)
+{
+    uint32_t words[APP_RESUME_BREG_COUNT];
+    uint32_t word;
+    bool valid;
+
+    Cy_SysPm_BackupWordReStore(APP_RESUME_BREG_INDEX, words,
+                               APP_RESUME_BREG_COUNT);
+    word = words[0];
+    valid = ((word >> APP_RESUME_MAGIC_POS) == APP_RESUME_MAGIC) &&
+            (words[1] == app_resume_checksum(word));
+
+    if (valid)
+    {
+        ctx->hibernate_count = (uint8_t)(word >> APP_RESUME_COUNT_POS);
+        ctx->power_mode = (uint8_t)(word >> APP_RESUME_MODE_POS);
+        ctx->ulp = (0UL != (word & APP_RESUME_FLAG_ULP));
+    }
+
+    words[0] = 0UL;
+    words[1] = 0UL;
+    Cy_SysPm_BackupWordStore(APP_RESUME_BREG_INDEX, words,
+                             APP_RESUME_BREG_COUNT);
+    return valid;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* File Name:   app_resume.h
+
+* Description: Provides the function definitions for the application
+*              context that is kept in the backup domain across Hibernate
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef APP_RESUME_H_
+#define APP_RESUME_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cyhal.h"
+#include "cybsp.h"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* First of the two backup registers that hold the context. The backup
+ * registers (CYW20829 Architecture TRM, "Backup domain") are general-purpose
+ * storage retained in Hibernate, accessed with Cy_SysPm_BackupWordStore()
+ * and Cy_SysPm_BackupWordReStore(). Neither this application, the BSP
+ * templates under templates/ nor retarget-io access them. The SysLib and
+ * SysPm drivers read the reset and Hibernate wakeup causes from the SRSS
+ * RES_CAUSE and PWR_HIBERNATE registers, not from the backup registers.
+ * Whether the boot ROM or a secure boot image uses them is not documented,
+ * so the last two registers are taken to stay clear of any use starting at
+ * register 0. Check the PDL release notes after updating the BSP or PDL,
+ * and override this index if a conflict is found. */
+#ifndef APP_RESUME_BREG_INDEX
+#define APP_RESUME_BREG_INDEX     (CY_SRSS_BACKUP_NUM_BREG - 2U)
+#endif
+
+/* Number of backup registers used for the context */
+#define APP_RESUME_BREG_COUNT     (2U)
+
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Application state restored after Hibernate */
+typedef struct
+{
+    uint8_t power_mode;         /* Power mode to continue in on wakeup */
+    bool ulp;                   /* true if the system was in ULP state */
+    uint8_t hibernate_count;    /* Hibernate cycles since the last cold boot */
+} app_resume_ctx_t;
+
+
+/*******************************************************************************
+* Function Declarations
+*******************************************************************************/
+void app_resume_save(const app_resume_ctx_t *ctx);
+bool app_resume_restore(app_resume_ctx_t *ctx);
+
+
+#endif /* APP_RESUME_H_ */
@@ -47,12 +47,10 @@
 * Header Files
 *******************************************************************************/
 #include "app_dsram.h"
-
-
-/*******************************************************************************
-* Macros
-*******************************************************************************/
-#define GPIO_INTERRUPT_PRIORITY   (2UL)
+#include "app_boot.h"
+#include "app_log.h"
+#include "app_resume.h"
+#include "app_input.h"
 
 
 /*******************************************************************************
@@ -62,11 +60,17 @@
 static volatile uint8_t power_modes = 0;
 
 /* System power state */
-static bool syspm_state = false;
+static volatile bool syspm_state = false;
 
-/* User Button Callbacks */
-static cyhal_gpio_callback_data_t btn1_cb;
-static cyhal_gpio_callback_data_t btn2_cb;
+/* Print the button statistics from the main loop */
+static volatile bool input_report = false;
+
+/* Set once retarget-io has been brought up by the deferred initialization */
+static bool uart_ready = false;
+
+/* Application context kept across Hibernate */
+static app_resume_ctx_t resume_ctx;
+static bool hibernate_resumed = false;
 
 /* Enum For changing the Power modes */
 enum PowerModes{
@@ -83,8 +87,10 @@ enum PowerModes{
 *******************************************************************************/
 static inline void handle_error(uint32_t status);
 static void switch_power_mode(void);
-static void gpio1_interrupt_handler(void *handler_arg,cyhal_gpio_event_t event);
-static void gpio2_interrupt_handler(void *handler_arg,cyhal_gpio_event_t event);
+static void app_idle_point(void);
+static cy_rslt_t app_uart_init(void);
+static cy_rslt_t app_print_banner(void);
+static void gesture_handler(app_input_gesture_t gesture, uint8_t buttons);
 
 
 /*******************************************************************************
@@ -110,6 +116,13 @@ int main(void)
     uint8_t hibernate_boot = (CY_SYSLIB_RESET_HIB_WAKEUP &
                                 Cy_SysLib_GetResetReason()) ? 1 : 0;
 
+    /* Start the boot phase timestamps, already started by the warm boot
+     * handler after DS-RAM */
+    if(!warm_boot)
+    {
+        app_boot_start(hibernate_boot ? APP_BOOT_HIBERNATE : APP_BOOT_COLD);
+    }
+
     /* Check if device reboots due to DSRAM */
     if(!warm_boot)
     {
@@ -122,10 +135,30 @@ int main(void)
     else
     {
         /* Free the required peripherals after waking-up from DS-RAM */
-        cy_retarget_io_deinit();
+        if(uart_ready)
+        {
+            app_log_enable(false);
+            cy_retarget_io_deinit();
+            uart_ready = false;
+        }
         cyhal_gpio_free(CYBSP_USER_LED);
         cyhal_gpio_free(CYBSP_USER_BTN2);
         cyhal_gpio_free(CYBSP_USER_BTN);
+        app_input_free();
+    }
+    app_boot_mark(APP_BOOT_PHASE_BSP_INIT);
+
+    /* Continue from the state saved before Hibernate, if any */
+    hibernate_resumed = hibernate_boot && app_resume_restore(&resume_ctx);
+    if(hibernate_resumed)
+    {
+        /* Resuming into DS-RAM is safe: the deferred UART and banner steps
+         * run at the start of the first main loop pass, before any
+         * low-power entry. A DS-RAM warm boot needs them to have run. */
+        power_modes = (resume_ctx.power_mode >= SYSPM_HIBERNATE) ?
+                        SYSPM_NORMAL : resume_ctx.power_mode;
+        cyhal_syspm_set_system_state(resume_ctx.ulp ?
+                        CYHAL_SYSPM_SYSTEM_LOW : CYHAL_SYSPM_SYSTEM_NORMAL);
     }
 
     /* Initialize the User LED */
@@ -145,74 +178,45 @@ int main(void)
                 CYBSP_USER_BTN_DRIVE, CYBSP_BTN_OFF);
     /* GPIO initialization failed. Stop program execution */
     handle_error(result);
+    app_boot_mark(APP_BOOT_PHASE_GPIO_INIT);
 
-    /* Configure Button interrupts */
-    btn1_cb.callback = &gpio1_interrupt_handler;
-    cyhal_gpio_register_callback(CYBSP_USER_BTN, &btn1_cb);
-    cyhal_gpio_enable_event(CYBSP_USER_BTN, CYHAL_GPIO_IRQ_FALL,
-                            GPIO_INTERRUPT_PRIORITY, true);
-
-    btn2_cb.callback = &gpio2_interrupt_handler;
-    cyhal_gpio_register_callback(CYBSP_USER_BTN2, &btn2_cb);
-    cyhal_gpio_enable_event(CYBSP_USER_BTN2, CYHAL_GPIO_IRQ_FALL,
-                            GPIO_INTERRUPT_PRIORITY, true);
+    /* Configure Button gestures, double press is selected per power mode by
+     * switch_power_mode() */
+    result = app_input_init(&gesture_handler, 0U);
+    /* Gesture engine initialization failed. Stop program execution */
+    handle_error(result);
 
     /* Enable global interrupts */
     __enable_irq();
-
-    /* Initialize retarget-io to use the debug UART port */
-    result = cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
-                                 CY_RETARGET_IO_BAUDRATE);
-    /* retarget-io initialization failed. Stop program execution */
-    handle_error(result);
+    app_boot_mark(APP_BOOT_PHASE_IRQ_CONFIG);
 
     /* Turn ON User LED after waking-up from DS-RAM */
     if(warm_boot)
     {
         warm_boot = 0;
         cyhal_gpio_write(CYBSP_USER_LED,CYBSP_LED_STATE_ON);
-
-        printf("\n Warmboot(Wake from DS-RAM) : Running "
-                "CYW20829 : Switching Power Modes Application\r\n");
-
-        printf("\n Entering to Hibernate press User Button 1 to come out "
-                "the system from Hibernate mode\r\n");
     }
-    /* Do the following routine after coming out from Hibernate */
-    else if(hibernate_boot)
-    {
-        if(Cy_SysPm_GetIoFreezeStatus())
-        {
-            /* Unfreeze the system */
-            Cy_SysPm_IoUnfreeze();
-        }
-        printf("\n Coldboot(Wake from Hibernate) : Running"
-                " CYW20829 : Switching Power Modes Application\r\n");
-    }
-    else
+    /* Release the IOs frozen by Hibernate */
+    else if(hibernate_boot && Cy_SysPm_GetIoFreezeStatus())
     {
-        /* Print a message on UART */
-        /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
-        printf("\x1b[2J\x1b[;H");
-        printf("**********CYW20829 : Switching Power Modes*************\r\n\n");
-
-        printf("=========================================================\r\n");
-        printf("| Press the User Button:                                |\r\n");
-        printf("|   Press User Button 1 to Change Power mode            |\r\n");
-        printf("|   Press User Button 2 to change power system          |\r\n");
-        printf("=========================================================\r\n");
+        /* Unfreeze the system */
+        Cy_SysPm_IoUnfreeze();
     }
 
-    /* DS-RAM Initialization */
-    result = cybsp_syspm_dsram_init();
+    /* UART and banner are not needed to reach idle; they run just before
+     * the first low-power entry of the main loop */
+    result = app_boot_defer(&app_uart_init);
+    handle_error(result);
+    result = app_boot_defer(&app_print_banner);
+    handle_error(result);
+
+    /* DS-RAM Initialization and DS/DS-RAM Call Back registration */
+    result = cy_app_syspm_init();
 
     /* Stop the Execution if DS-RAM Initialization failed */
     handle_error(result);
 
-    /* Register the DS-RAM Call Back */
-    cy_app_register_syspm_dsram_callback();
-
-    cy_app_register_syspm_ds_callback();
+    app_boot_mark(APP_BOOT_PHASE_DSRAM_INIT);
 
     for (;;)
     {
@@ -222,52 +226,160 @@ int main(void)
 
 
 /*******************************************************************************
-* Function Name: gpio1_interrupt_handler
+* Function Name: app_idle_point
 ********************************************************************************
 * Summary:
-*  GPIO interrupt handler will change the power modes from
-*  Active to Sleep
-*  Active to DeepSleep
-*  Active to DeepSleep-RAM
-*  Active to Hibernate
+*  Called at the start of each main loop pass, before its transition messages
+*  and its low-power entry. The first call brings up the deferred peripherals
+*  and prints the boot profile, so no message of the first pass is lost.
 *
 * Parameters:
-*  void *handler_arg
-*  cyhal_gpio_irq_event_t
+*  void
 *
 * Return:
-*  static void
+*  void
+*
+*******************************************************************************/
+static void app_idle_point(void)
+{
+    cy_rslt_t result;
+
+    if(app_boot_deferred_pending())
+    {
+        app_boot_mark(APP_BOOT_PHASE_FIRST_IDLE);
+        result = app_boot_run_deferred();
+
+        /* Stop the Execution if a deferred initialization failed */
+        handle_error(result);
+        app_boot_report();
+#if (APP_DSRAM_TRACE_ENABLE)
+        cy_app_syspm_trace_report();
+#endif /* APP_DSRAM_TRACE_ENABLE */
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: app_uart_init
+********************************************************************************
+* Summary:
+*  Deferred initialization of retarget-io on the debug UART port
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t
+*
+*******************************************************************************/
+static cy_rslt_t app_uart_init(void)
+{
+    cy_rslt_t result;
+
+    /* Initialize retarget-io to use the debug UART port */
+    result = cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
+                                 CY_RETARGET_IO_BAUDRATE);
+    uart_ready = (CY_RSLT_SUCCESS == result);
+    app_log_enable(uart_ready);
+    app_boot_mark(APP_BOOT_PHASE_UART_INIT);
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: app_print_banner
+********************************************************************************
+* Summary:
+*  Deferred printing of the start-up message for the current boot type
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t CY_RSLT_SUCCESS
 *
 *******************************************************************************/
-static void gpio1_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
+static cy_rslt_t app_print_banner(void)
 {
-    (void)handler_arg;
-    (void)event;
-    power_modes++;
+    switch(app_boot_get_type())
+    {
+        case APP_BOOT_WARM:
+            APP_LOG(LOG_WARMBOOT);
+            break;
+        case APP_BOOT_HIBERNATE:
+            if(hibernate_resumed)
+            {
+                APP_LOG(resume_ctx.ulp ? LOG_HIBERNATE_RESUME_ULP :
+                        LOG_HIBERNATE_RESUME_LP,
+                        (uint32_t)resume_ctx.hibernate_count);
+            }
+            else
+            {
+                APP_LOG(LOG_HIBERNATE_WAKE);
+            }
+            break;
+        default:
+            /* Clear screen and print the usage banner */
+            APP_LOG(LOG_BANNER);
+            break;
+    }
+    app_boot_mark(APP_BOOT_PHASE_BANNER);
+    return CY_RSLT_SUCCESS;
 }
 
 
 /*******************************************************************************
-* Function Name: gpio2_interrupt_handler
+* Function Name: gesture_handler
 ********************************************************************************
 * Summary:
-*  GPIO interrupt handler will change the power system from Low Power system to
-*  Ultra Low Power system and vise versa
+*  Button gesture handler, called from interrupt context
+*  User Button 1 short press  : next power mode
+*  User Button 1 double press : back to Active mode
+*  User Button 1 long press   : Hibernate
+*  User Button 2 short press  : change the power system (LP/ULP)
+*  Both buttons (chord)       : print the button statistics
 *
 * Parameters:
-*  void *handler_arg
-*  cyhal_gpio_irq_event_t
+*  app_input_gesture_t gesture
+*  uint8_t buttons - APP_INPUT_BTN1 and/or APP_INPUT_BTN2
 *
 * Return:
 *  static void
 *
 *******************************************************************************/
-static void gpio2_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
+static void gesture_handler(app_input_gesture_t gesture, uint8_t buttons)
 {
-    (void)handler_arg;
-    (void)event;
-    syspm_state = true;
-    power_modes = SYSPM_NORMAL;
+    switch(gesture)
+    {
+        case APP_INPUT_CHORD:
+            input_report = true;
+            break;
+        case APP_INPUT_LONG:
+            if((APP_INPUT_BTN1 == buttons) && (power_modes < SYSPM_HIBERNATE))
+            {
+                /* Continue in the current mode after Hibernate */
+                resume_ctx.power_mode = power_modes;
+                power_modes = SYSPM_HIBERNATE;
+            }
+            break;
+        case APP_INPUT_DOUBLE:
+            power_modes = SYSPM_NORMAL;
+            break;
+        default:
+            if(APP_INPUT_BTN1 == buttons)
+            {
+                power_modes++;
+                /* Hibernate is the last mode, the cycle restarts from
+                 * Active after wakeup */
+                resume_ctx.power_mode = SYSPM_NORMAL;
+            }
+            else
+            {
+                syspm_state = true;
+                power_modes = SYSPM_NORMAL;
+            }
+            break;
+    }
 }
 
 
@@ -311,6 +423,39 @@ static void switch_power_mode(void)
 {
     cy_rslt_t result;
 
+    /* Nothing below runs before a low-power entry except the transition
+     * messages, so this is the idle point of the main loop */
+    app_idle_point();
+
+    if(input_report)
+    {
+        input_report = false;
+        app_input_report();
+    }
+
+    /* A double press of User Button 1 returns to Active. Decode it only in
+     * Sleep and DeepSleep: Active has nowhere to return to and a DS-RAM
+     * wakeup restarts from main(). Without it a press costs one edge and
+     * one LPTimer wakeup. */
+    app_input_set_double(((SYSPM_SLEEP == power_modes) ||
+                          (SYSPM_DEEPSLEEP == power_modes)) ?
+                         APP_INPUT_BTN1 : 0U);
+
+    /* Keep the selected mode quiet while a button gesture is sampled */
+    if(app_input_busy())
+    {
+        if(power_modes >= SYSPM_DEEPSLEEP)
+        {
+            Cy_SysPm_SetDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP);
+            cyhal_syspm_deepsleep();
+        }
+        else if(power_modes == SYSPM_SLEEP)
+        {
+            cyhal_syspm_sleep();
+        }
+        return;
+    }
+
     if(syspm_state == true)
     {
         /* Check if the device is in System Ultra Low Power state */
@@ -325,8 +470,8 @@ static void switch_power_mode(void)
             cyhal_syspm_set_system_state(CYHAL_SYSPM_SYSTEM_LOW);
         }
 
-        printf("\n Switching the System Power system : %s \r\n",
-                cyhal_syspm_get_system_state() ? "ULP": "LP");
+        APP_LOG(cyhal_syspm_get_system_state() ?
+                LOG_SYSTEM_ULP : LOG_SYSTEM_LP);
         syspm_state=false;
 
     }
@@ -334,13 +479,11 @@ static void switch_power_mode(void)
     switch(power_modes)
     {
         case SYSPM_SLEEP:
-            printf("\n Going to Sleep : Running"
-                    " CYW20829 : Switching Power Modes Application\r\n");
+            APP_LOG(LOG_SLEEP_ENTER);
             result = cyhal_syspm_sleep();
             if(result == CY_SYSPM_SUCCESS)
             {
-                printf("\n Wake from Sleep : Running"
-                        " CYW20829 : Switching Power Modes Application\r\n");
+                APP_LOG(LOG_SLEEP_WAKE);
             }
             break;
         case SYSPM_DEEPSLEEP:
@@ -348,8 +491,10 @@ static void switch_power_mode(void)
             result = cyhal_syspm_deepsleep();
             if(result == CY_SYSPM_SUCCESS)
             {
-                printf("\n Wake from Deep Sleep : Running"
-                        " CYW20829 : Switching Power Modes Application\r\n");
+                APP_LOG(LOG_DEEPSLEEP_WAKE);
+#if (APP_DSRAM_TRACE_ENABLE)
+                cy_app_syspm_trace_report();
+#endif /* APP_DSRAM_TRACE_ENABLE */
             }
             break;
         case SYSPM_DEEPSLEEP_RAM:
@@ -358,6 +503,13 @@ static void switch_power_mode(void)
             break;
         case SYSPM_HIBERNATE:
             Cy_SysLib_Delay(1000/* msec */);
+
+            /* Save the state to be restored on wakeup */
+            resume_ctx.ulp = (cyhal_syspm_get_system_state() ==
+                                CYHAL_SYSPM_SYSTEM_LOW);
+            resume_ctx.hibernate_count++;
+            app_resume_save(&resume_ctx);
+
             cyhal_syspm_hibernate(CYHAL_SYSPM_HIBERNATE_PINA_LOW);
             break;
         default:
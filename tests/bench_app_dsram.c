@@ -0,0 +1,176 @@
+/******************************************************************************
+* File Name:   bench_app_dsram.c
+*
+* Description: Host benchmark of the DeepSleep and DeepSleep-RAM callbacks in
+*              app_dsram.c. Each callback is run through a number of complete
+*              transitions, in the order the PDL runs the callback modes, and
+*              the time and the HAL calls per transition are reported. The
+*              HAL and PDL calls are mocked and only counted. Built twice by
+*              tests/Makefile, with and without APP_DSRAM_TRACE_ENABLE, so
+*              the cost of the trace can be compared. Run with:
+*
+*                make -C tests bench
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <time.h>
+
+#include "../app_dsram.c"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Transitions run per callback */
+#ifndef BENCH_TRANSITIONS
+#define BENCH_TRANSITIONS         (1000000UL)
+#endif
+
+#define BENCH_NS_PER_S            (1000000000ULL)
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+CoreDebug_Type test_core_debug;
+DWT_Type test_dwt;
+unsigned int __INITIAL_SP;
+cyhal_uart_t cy_retarget_io_uart_obj;
+
+/* HAL and PDL calls made by the callbacks */
+static volatile uint32_t bench_hal_calls;
+
+/* Callback return values that were not CY_SYSPM_SUCCESS */
+static uint32_t bench_failures;
+
+
+/*******************************************************************************
+* Mocks
+*******************************************************************************/
+cy_rslt_t cyhal_gpio_configure(cyhal_gpio_t pin,
+                               cyhal_gpio_direction_t direction,
+                               cyhal_gpio_drive_mode_t drive_mode)
+{
+    (void)pin;
+    (void)direction;
+    (void)drive_mode;
+    bench_hal_calls++;
+    return CY_RSLT_SUCCESS;
+}
+
+void System_Store_NVIC_Reg(void)
+{
+    bench_hal_calls++;
+}
+
+bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t *handler)
+{
+    (void)handler;
+    return true;
+}
+
+void Cy_Syslib_SetWarmBootEntryPoint(uint32_t *entryPoint, bool enable)
+{
+    (void)entryPoint;
+    (void)enable;
+}
+
+#if (APP_DSRAM_TRACE_ENABLE)
+void app_log_printf(app_log_token_t token, ...)
+{
+    (void)token;
+}
+#endif /* APP_DSRAM_TRACE_ENABLE */
+
+/* Used by the warm boot handler only, which is not run on the host */
+cy_en_syspm_status_t Cy_SysPm_ExecuteCallback(cy_en_syspm_callback_type_t type,
+                                              cy_en_syspm_callback_mode_t mode)
+{
+    (void)type;
+    (void)mode;
+    return CY_SYSPM_SUCCESS;
+}
+
+void app_boot_start(app_boot_type_t type) { (void)type; }
+void app_boot_mark(app_boot_phase_t phase) { (void)phase; }
+void app_boot_record(app_boot_phase_t phase, uint32_t cycles)
+{
+    (void)phase;
+    (void)cycles;
+}
+void SystemInit_Warmboot_CAT1B_CM33(void) {}
+void System_Restore_NVIC_Reg(void) {}
+void init_cycfg_all(void) {}
+cy_rslt_t cybsp_smif_enable(void) { return CY_RSLT_SUCCESS; }
+cy_rslt_t cybsp_smif_init(void) { return CY_RSLT_SUCCESS; }
+
+
+/*******************************************************************************
+* Benchmark
+*******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * BENCH_NS_PER_S) + (uint64_t)now.tv_nsec;
+}
+
+/* Runs complete transitions through a callback and prints one result line */
+static void bench_callback(const char *name, Cy_SysPmCallback callback,
+                           unsigned long transitions)
+{
+    static const cy_en_syspm_callback_mode_t modes[] =
+    {
+        CY_SYSPM_CHECK_READY,
+        CY_SYSPM_BEFORE_TRANSITION,
+        CY_SYSPM_AFTER_DS_WFI_TRANSITION,
+        CY_SYSPM_AFTER_TRANSITION
+    };
+    uint32_t calls = bench_hal_calls;
+    uint64_t start = bench_now_ns();
+    uint64_t elapsed;
+
+    for (unsigned long i = 0; i < transitions; i++)
+    {
+        for (uint32_t m = 0; m < (sizeof(modes) / sizeof(modes[0])); m++)
+        {
+            if (CY_SYSPM_SUCCESS != callback(NULL, modes[m]))
+            {
+                bench_failures++;
+            }
+        }
+    }
+
+    elapsed = bench_now_ns() - start;
+    calls = bench_hal_calls - calls;
+
+    printf("  %-22s %10lu transitions %8.2f ns/transition "
+           "%5.2f HAL calls/transition\n", name, transitions,
+           (double)elapsed / (double)transitions,
+           (double)calls / (double)transitions);
+}
+
+
+int main(void)
+{
+    unsigned long transitions = BENCH_TRANSITIONS;
+
+    printf("bench_app_dsram (APP_DSRAM_TRACE_ENABLE=%u):\n",
+           (unsigned)APP_DSRAM_TRACE_ENABLE);
+    bench_callback("cy_app_ds_callback", &cy_app_ds_callback, transitions);
+    bench_callback("cy_app_dsram_callback", &cy_app_dsram_callback,
+                   transitions);
+
+    if (0U != bench_failures)
+    {
+        printf("  %u callback failures\n", (unsigned)bench_failures);
+    }
+    return (0U == bench_failures) ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+/* Host test stand-in for retarget-io */
+#ifndef CY_RETARGET_IO_H_
+#define CY_RETARGET_IO_H_
+
+#include "cyhal.h"
+
+extern cyhal_uart_t cy_retarget_io_uart_obj;
+
+#endif /* CY_RETARGET_IO_H_ */
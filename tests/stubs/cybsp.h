@@ -0,0 +1,11 @@
+/* Host test stand-in for the BSP */
+#ifndef CYBSP_H_
+#define CYBSP_H_
+
+#include "cyhal.h"
+
+#define CYBSP_BT_UART_RTS                   ((cyhal_gpio_t)0x21U)
+#define CYBSP_BT_UART_CTS                   ((cyhal_gpio_t)0x22U)
+#define CYBSP_RSLT_ERR_SYSCLK_PM_CALLBACK   ((cy_rslt_t)0x04010001U)
+
+#endif /* CYBSP_H_ */
@@ -0,0 +1,10 @@
+/* Host test stand-in for the BSP SMIF initialization */
+#ifndef CYBSP_SMIF_INIT_H_
+#define CYBSP_SMIF_INIT_H_
+
+#include "cyhal.h"
+
+cy_rslt_t cybsp_smif_enable(void);
+cy_rslt_t cybsp_smif_init(void);
+
+#endif /* CYBSP_SMIF_INIT_H_ */
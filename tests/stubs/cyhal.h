@@ -0,0 +1,133 @@
+/* Host test stand-in for the HAL and PDL declarations used by the
+ * application. Only what app_dsram.c needs is declared; the functions are
+ * mocked in test_app_dsram.c. */
+#ifndef CYHAL_H_
+#define CYHAL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t cy_rslt_t;
+#define CY_RSLT_SUCCESS                     ((cy_rslt_t)0x00000000U)
+#define CY_UNUSED_PARAMETER(x)              ((void)(x))
+#define CY_SECTION_RAMFUNC_BEGIN
+#define CY_SECTION_RAMFUNC_END
+
+typedef enum
+{
+    CYHAL_GPIO_DIR_INPUT,
+    CYHAL_GPIO_DIR_OUTPUT,
+    CYHAL_GPIO_DIR_BIDIRECTIONAL
+} cyhal_gpio_direction_t;
+
+typedef enum
+{
+    CYHAL_GPIO_DRIVE_NONE,
+    CYHAL_GPIO_DRIVE_ANALOG,
+    CYHAL_GPIO_DRIVE_PULLUP,
+    CYHAL_GPIO_DRIVE_PULLDOWN,
+    CYHAL_GPIO_DRIVE_OPENDRAINDRIVESLOW,
+    CYHAL_GPIO_DRIVE_OPENDRAINDRIVESHIGH,
+    CYHAL_GPIO_DRIVE_STRONG,
+    CYHAL_GPIO_DRIVE_PULLUPDOWN,
+    CYHAL_GPIO_DRIVE_PULL_NONE
+} cyhal_gpio_drive_mode_t;
+
+typedef uint32_t cyhal_gpio_t;
+
+typedef enum
+{
+    CY_SYSPM_SUCCESS,
+    CY_SYSPM_BAD_PARAM,
+    CY_SYSPM_TIMEOUT,
+    CY_SYSPM_INVALID_STATE,
+    CY_SYSPM_CANCELED,
+    CY_SYSPM_SYSCALL_PENDING,
+    CY_SYSPM_FAIL
+} cy_en_syspm_status_t;
+
+typedef enum
+{
+    CY_SYSPM_CHECK_READY = 0x01U,
+    CY_SYSPM_CHECK_FAIL = 0x02U,
+    CY_SYSPM_BEFORE_TRANSITION = 0x04U,
+    CY_SYSPM_AFTER_TRANSITION = 0x08U,
+    CY_SYSPM_AFTER_DS_WFI_TRANSITION = 0x10U
+} cy_en_syspm_callback_mode_t;
+
+typedef enum
+{
+    CY_SYSPM_SLEEP,
+    CY_SYSPM_DEEPSLEEP,
+    CY_SYSPM_HIBERNATE,
+    CY_SYSPM_DEEPSLEEP_RAM = 6
+} cy_en_syspm_callback_type_t;
+
+typedef struct
+{
+    void *base;
+    void *context;
+} cy_stc_syspm_callback_params_t;
+
+typedef cy_en_syspm_status_t (*Cy_SysPmCallback)
+    (cy_stc_syspm_callback_params_t *callbackParams,
+     cy_en_syspm_callback_mode_t mode);
+
+typedef struct cy_stc_syspm_callback
+{
+    Cy_SysPmCallback callback;
+    cy_en_syspm_callback_type_t type;
+    uint32_t skipMode;
+    cy_stc_syspm_callback_params_t *callbackParams;
+    struct cy_stc_syspm_callback *prevItm;
+    struct cy_stc_syspm_callback *nextItm;
+    uint8_t order;
+} cy_stc_syspm_callback_t;
+
+typedef struct
+{
+    uint32_t *stack_pointer;
+    uint32_t *entry_pointer;
+} cy_stc_syspm_warmboot_entrypoint_t;
+
+/* Cycle counter */
+typedef struct
+{
+    uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+#define CoreDebug_DEMCR_TRCENA_Msk          (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA_Msk              (1UL)
+
+extern CoreDebug_Type test_core_debug;
+extern DWT_Type test_dwt;
+#define CoreDebug                           (&test_core_debug)
+#define DWT                                 (&test_dwt)
+
+typedef struct
+{
+    int unused;
+} cyhal_uart_t;
+
+extern unsigned int __INITIAL_SP;
+
+cy_rslt_t cyhal_gpio_configure(cyhal_gpio_t pin,
+                               cyhal_gpio_direction_t direction,
+                               cyhal_gpio_drive_mode_t drive_mode);
+bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t *handler);
+cy_en_syspm_status_t Cy_SysPm_ExecuteCallback(cy_en_syspm_callback_type_t type,
+                                              cy_en_syspm_callback_mode_t mode);
+void Cy_Syslib_SetWarmBootEntryPoint(uint32_t *entryPoint, bool enable);
+void SystemInit_Warmboot_CAT1B_CM33(void);
+void System_Store_NVIC_Reg(void);
+void System_Restore_NVIC_Reg(void);
+void init_cycfg_all(void);
+
+#endif /* CYHAL_H_ */
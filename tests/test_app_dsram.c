@@ -0,0 +1,446 @@
+/******************************************************************************
+* File Name:   test_app_dsram.c
+*
+* Description: Host tests of the DeepSleep and DeepSleep-RAM callbacks in
+*              app_dsram.c. The HAL and PDL calls made by the callbacks are
+*              mocked and recorded, so every callback mode, its return value
+*              and the HAL calls made per transition are checked without the
+*              device. Built twice by tests/Makefile, with and without
+*              APP_DSRAM_TRACE_ENABLE.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Included so that the static trace state can be inspected */
+#include "../app_dsram.c"
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_MAX_CALLS            (16U)
+
+/* Callback mode that is not handled by the callbacks */
+#define TEST_MODE_UNKNOWN         ((cy_en_syspm_callback_mode_t)0x20U)
+
+/* Cycles added to the cycle counter by each mocked HAL call */
+#define TEST_CYCLES_PER_CALL      (100U)
+
+#define CHECK(cond)                                                           \
+    do                                                                        \
+    {                                                                         \
+        test_checks++;                                                        \
+        if (!(cond))                                                          \
+        {                                                                     \
+            test_failures++;                                                  \
+            printf("%s:%d: %s: check failed: %s\n", __FILE__, __LINE__,       \
+                   __func__, #cond);                                          \
+        }                                                                     \
+    } while (0)
+
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Mocked calls, in the order they are made */
+typedef enum
+{
+    CALL_GPIO_CONFIGURE,
+    CALL_REGISTER_CALLBACK,
+    CALL_STORE_NVIC,
+    CALL_SET_WARM_BOOT_ENTRY
+} test_call_type_t;
+
+typedef struct
+{
+    test_call_type_t type;
+    cyhal_gpio_t pin;
+    cyhal_gpio_direction_t direction;
+    cyhal_gpio_drive_mode_t drive_mode;
+    cy_stc_syspm_callback_t *handler;
+    uint32_t *entry_point;
+    bool enable;
+} test_call_t;
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+CoreDebug_Type test_core_debug;
+DWT_Type test_dwt;
+unsigned int __INITIAL_SP;
+cyhal_uart_t cy_retarget_io_uart_obj;
+
+static test_call_t test_calls[TEST_MAX_CALLS];
+static uint32_t test_call_count;
+static bool test_register_result;
+
+#if (APP_DSRAM_TRACE_ENABLE)
+static app_log_token_t test_log_tokens[TEST_MAX_CALLS];
+static uint32_t test_log_args[TEST_MAX_CALLS][APP_LOG_MAX_ARGS];
+static uint32_t test_log_count;
+#endif /* APP_DSRAM_TRACE_ENABLE */
+
+static uint32_t test_checks;
+static uint32_t test_failures;
+
+
+/*******************************************************************************
+* Mocks
+*******************************************************************************/
+static test_call_t *test_record(test_call_type_t type)
+{
+    test_call_t *call = &test_calls[test_call_count % TEST_MAX_CALLS];
+
+    memset(call, 0, sizeof(*call));
+    call->type = type;
+    test_call_count++;
+
+    if (0U != (test_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        test_dwt.CYCCNT += TEST_CYCLES_PER_CALL;
+    }
+    return call;
+}
+
+cy_rslt_t cyhal_gpio_configure(cyhal_gpio_t pin,
+                               cyhal_gpio_direction_t direction,
+                               cyhal_gpio_drive_mode_t drive_mode)
+{
+    test_call_t *call = test_record(CALL_GPIO_CONFIGURE);
+
+    call->pin = pin;
+    call->direction = direction;
+    call->drive_mode = drive_mode;
+    return CY_RSLT_SUCCESS;
+}
+
+bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t *handler)
+{
+    test_record(CALL_REGISTER_CALLBACK)->handler = handler;
+    return test_register_result;
+}
+
+void System_Store_NVIC_Reg(void)
+{
+    (void)test_record(CALL_STORE_NVIC);
+}
+
+void Cy_Syslib_SetWarmBootEntryPoint(uint32_t *entryPoint, bool enable)
+{
+    test_call_t *call = test_record(CALL_SET_WARM_BOOT_ENTRY);
+
+    call->entry_point = entryPoint;
+    call->enable = enable;
+}
+
+#if (APP_DSRAM_TRACE_ENABLE)
+void app_log_printf(app_log_token_t token, ...)
+{
+    va_list args;
+    uint32_t index = test_log_count % TEST_MAX_CALLS;
+
+    test_log_tokens[index] = token;
+    va_start(args, token);
+    for (uint32_t i = 0; i < APP_LOG_MAX_ARGS; i++)
+    {
+        test_log_args[index][i] = va_arg(args, uint32_t);
+    }
+    va_end(args);
+    test_log_count++;
+}
+#endif /* APP_DSRAM_TRACE_ENABLE */
+
+/* Used by the warm boot handler only, which is not run on the host */
+cy_en_syspm_status_t Cy_SysPm_ExecuteCallback(cy_en_syspm_callback_type_t type,
+                                              cy_en_syspm_callback_mode_t mode)
+{
+    (void)type;
+    (void)mode;
+    return CY_SYSPM_SUCCESS;
+}
+
+void app_boot_start(app_boot_type_t type) { (void)type; }
+void app_boot_mark(app_boot_phase_t phase) { (void)phase; }
+void app_boot_record(app_boot_phase_t phase, uint32_t cycles)
+{
+    (void)phase;
+    (void)cycles;
+}
+void SystemInit_Warmboot_CAT1B_CM33(void) {}
+void System_Restore_NVIC_Reg(void) {}
+void init_cycfg_all(void) {}
+cy_rslt_t cybsp_smif_enable(void) { return CY_RSLT_SUCCESS; }
+cy_rslt_t cybsp_smif_init(void) { return CY_RSLT_SUCCESS; }
+
+
+/*******************************************************************************
+* Helpers
+*******************************************************************************/
+static void test_reset(void)
+{
+    memset(test_calls, 0, sizeof(test_calls));
+    test_call_count = 0;
+    test_register_result = true;
+    memset(&test_core_debug, 0, sizeof(test_core_debug));
+    memset(&test_dwt, 0, sizeof(test_dwt));
+#if (APP_DSRAM_TRACE_ENABLE)
+    test_log_count = 0;
+    memset(&ds_trace, 0, sizeof(ds_trace));
+    memset(&dsram_trace, 0, sizeof(dsram_trace));
+#endif /* APP_DSRAM_TRACE_ENABLE */
+}
+
+static void check_gpio_call(uint32_t index, cyhal_gpio_t pin, bool parked)
+{
+    const test_call_t *call = &test_calls[index];
+
+    CHECK(CALL_GPIO_CONFIGURE == call->type);
+    CHECK(pin == call->pin);
+    if (parked)
+    {
+        CHECK(CYHAL_GPIO_DIR_INPUT == call->direction);
+        CHECK(CYHAL_GPIO_DRIVE_ANALOG == call->drive_mode);
+    }
+    else
+    {
+        CHECK(CYHAL_GPIO_DIR_OUTPUT == call->direction);
+        CHECK(CYHAL_GPIO_DRIVE_PULL_NONE == call->drive_mode);
+    }
+}
+
+/* Modes with no work to do return success without any HAL call; an unknown
+ * mode fails */
+static void check_passive_modes(Cy_SysPmCallback callback)
+{
+    static const cy_en_syspm_callback_mode_t modes[] =
+    {
+        CY_SYSPM_CHECK_READY,
+        CY_SYSPM_CHECK_FAIL,
+        CY_SYSPM_AFTER_DS_WFI_TRANSITION
+    };
+
+    for (uint32_t i = 0; i < (sizeof(modes) / sizeof(modes[0])); i++)
+    {
+        test_reset();
+        CHECK(CY_SYSPM_SUCCESS == callback(NULL, modes[i]));
+        CHECK(0U == test_call_count);
+    }
+
+    test_reset();
+    CHECK(CY_SYSPM_FAIL == callback(NULL, TEST_MODE_UNKNOWN));
+    CHECK(0U == test_call_count);
+}
+
+
+/*******************************************************************************
+* Tests
+*******************************************************************************/
+static void test_ds_callback_modes(void)
+{
+    check_passive_modes(&cy_app_ds_callback);
+
+    test_reset();
+    CHECK(CY_SYSPM_SUCCESS ==
+          cy_app_ds_callback(NULL, CY_SYSPM_BEFORE_TRANSITION));
+    CHECK(2U == test_call_count);
+    check_gpio_call(0, CYBSP_BT_UART_RTS, true);
+    check_gpio_call(1, CYBSP_BT_UART_CTS, true);
+
+    test_reset();
+    CHECK(CY_SYSPM_SUCCESS ==
+          cy_app_ds_callback(NULL, CY_SYSPM_AFTER_TRANSITION));
+    CHECK(2U == test_call_count);
+    check_gpio_call(0, CYBSP_BT_UART_RTS, false);
+    check_gpio_call(1, CYBSP_BT_UART_CTS, false);
+}
+
+static void test_dsram_callback_modes(void)
+{
+    check_passive_modes(&cy_app_dsram_callback);
+
+    test_reset();
+    CHECK(CY_SYSPM_SUCCESS ==
+          cy_app_dsram_callback(NULL, CY_SYSPM_BEFORE_TRANSITION));
+    CHECK(3U == test_call_count);
+    check_gpio_call(0, CYBSP_BT_UART_RTS, true);
+    check_gpio_call(1, CYBSP_BT_UART_CTS, true);
+    CHECK(CALL_STORE_NVIC == test_calls[2].type);
+
+    test_reset();
+    CHECK(CY_SYSPM_SUCCESS ==
+          cy_app_dsram_callback(NULL, CY_SYSPM_AFTER_TRANSITION));
+    CHECK(2U == test_call_count);
+    check_gpio_call(0, CYBSP_BT_UART_RTS, false);
+    check_gpio_call(1, CYBSP_BT_UART_CTS, false);
+}
+
+/* HAL calls made by one complete transition, as run by the PDL */
+static uint32_t run_transition(Cy_SysPmCallback callback)
+{
+    uint32_t start = test_call_count;
+
+    CHECK(CY_SYSPM_SUCCESS == callback(NULL, CY_SYSPM_CHECK_READY));
+    CHECK(CY_SYSPM_SUCCESS == callback(NULL, CY_SYSPM_BEFORE_TRANSITION));
+    CHECK(CY_SYSPM_SUCCESS == callback(NULL, CY_SYSPM_AFTER_DS_WFI_TRANSITION));
+    CHECK(CY_SYSPM_SUCCESS == callback(NULL, CY_SYSPM_AFTER_TRANSITION));
+    return test_call_count - start;
+}
+
+static void test_hal_calls_per_transition(void)
+{
+    test_reset();
+    CHECK(4U == run_transition(&cy_app_ds_callback));
+    CHECK(4U == run_transition(&cy_app_ds_callback));
+
+    test_reset();
+    CHECK(5U == run_transition(&cy_app_dsram_callback));
+    CHECK(5U == run_transition(&cy_app_dsram_callback));
+}
+
+static void test_register_callbacks(void)
+{
+    cy_stc_syspm_callback_t *handler;
+
+    test_reset();
+    CHECK(CY_RSLT_SUCCESS == cy_app_register_syspm_ds_callback());
+    CHECK(1U == test_call_count);
+    handler = test_calls[0].handler;
+    CHECK(CALL_REGISTER_CALLBACK == test_calls[0].type);
+    CHECK(&cy_app_ds_callback == handler->callback);
+    CHECK(CY_SYSPM_DEEPSLEEP == handler->type);
+    CHECK(NULL != handler->callbackParams);
+    CHECK(0U == handler->order);
+
+    test_reset();
+    CHECK(CY_RSLT_SUCCESS == cy_app_register_syspm_dsram_callback());
+    CHECK(1U == test_call_count);
+    handler = test_calls[0].handler;
+    CHECK(&cy_app_dsram_callback == handler->callback);
+    CHECK(CY_SYSPM_DEEPSLEEP_RAM == handler->type);
+    CHECK(NULL != handler->callbackParams);
+    CHECK(0U == handler->order);
+
+    test_reset();
+    test_register_result = false;
+    CHECK(CYBSP_RSLT_ERR_SYSCLK_PM_CALLBACK ==
+          cy_app_register_syspm_ds_callback());
+    CHECK(CYBSP_RSLT_ERR_SYSCLK_PM_CALLBACK ==
+          cy_app_register_syspm_dsram_callback());
+}
+
+static void test_syspm_init_order(void)
+{
+    test_reset();
+    CHECK(CY_RSLT_SUCCESS == cy_app_syspm_init());
+    CHECK(3U == test_call_count);
+
+    /* Warm boot entry point first, then DS-RAM and DS callbacks */
+    CHECK(CALL_SET_WARM_BOOT_ENTRY == test_calls[0].type);
+    CHECK((uint32_t *)&syspm_app_dsram_entry_point ==
+          test_calls[0].entry_point);
+    CHECK(!test_calls[0].enable);
+    CHECK(CALL_REGISTER_CALLBACK == test_calls[1].type);
+    CHECK(&cy_app_dsram_callback == test_calls[1].handler->callback);
+    CHECK(CALL_REGISTER_CALLBACK == test_calls[2].type);
+    CHECK(&cy_app_ds_callback == test_calls[2].handler->callback);
+
+    /* Registration is repeated on warm boot, a failure is not fatal */
+    test_reset();
+    test_register_result = false;
+    CHECK(CY_RSLT_SUCCESS == cy_app_syspm_init());
+    CHECK(3U == test_call_count);
+}
+
+#if (APP_DSRAM_TRACE_ENABLE)
+static void test_trace_transitions(void)
+{
+    test_reset();
+    (void)run_transition(&cy_app_ds_callback);
+    (void)run_transition(&cy_app_ds_callback);
+    (void)run_transition(&cy_app_dsram_callback);
+
+    CHECK(2U == ds_trace.transitions);
+    CHECK(8U == ds_trace.hal_calls);
+    CHECK(0U == ds_trace.order_errors);
+    CHECK(0U == ds_trace.pin_errors);
+    CHECK(1U == dsram_trace.transitions);
+    CHECK(5U == dsram_trace.hal_calls);
+    CHECK(0U == dsram_trace.pin_errors);
+
+    /* The callbacks start the cycle counter themselves */
+    CHECK(0U != (test_core_debug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk));
+    CHECK(0U != (test_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk));
+    CHECK(3U * TEST_CYCLES_PER_CALL == dsram_trace.max_cycles);
+
+    cy_app_syspm_trace_report();
+    CHECK(2U == test_log_count);
+    CHECK(LOG_SYSPM_TRACE_DS == test_log_tokens[0]);
+    CHECK(2U == test_log_args[0][0]);
+    CHECK(8U == test_log_args[0][1]);
+    CHECK(0U == test_log_args[0][2]);
+    CHECK(LOG_SYSPM_TRACE_DSRAM == test_log_tokens[1]);
+    CHECK(1U == test_log_args[1][0]);
+    CHECK(5U == test_log_args[1][1]);
+}
+
+static void test_trace_order_error(void)
+{
+    test_reset();
+    (void)cy_app_ds_callback(NULL, CY_SYSPM_AFTER_TRANSITION);
+    CHECK(1U == ds_trace.order_errors);
+
+    /* Restoring pins that were never parked */
+    CHECK(2U == ds_trace.pin_errors);
+}
+
+static void test_trace_pin_symmetry(void)
+{
+    test_reset();
+    cy_app_gpio_configure(&ds_trace, CYBSP_BT_UART_RTS, CYHAL_GPIO_DIR_INPUT,
+                          CYHAL_GPIO_DRIVE_ANALOG);
+    cy_app_gpio_configure(&ds_trace, CYBSP_BT_UART_CTS, CYHAL_GPIO_DIR_INPUT,
+                          CYHAL_GPIO_DRIVE_ANALOG);
+    CHECK(0x3U == ds_trace.parked_mask);
+
+    /* RTS restored twice while CTS stays parked */
+    cy_app_gpio_configure(&ds_trace, CYBSP_BT_UART_RTS, CYHAL_GPIO_DIR_OUTPUT,
+                          CYHAL_GPIO_DRIVE_PULL_NONE);
+    cy_app_gpio_configure(&ds_trace, CYBSP_BT_UART_RTS, CYHAL_GPIO_DIR_OUTPUT,
+                          CYHAL_GPIO_DRIVE_PULL_NONE);
+    CHECK(1U == ds_trace.pin_errors);
+    CHECK(0x2U == ds_trace.parked_mask);
+
+    /* CTS still parked at the end of the transition */
+    ds_trace.in_transition = true;
+    cy_app_trace_end(&ds_trace, CY_SYSPM_AFTER_TRANSITION, 0);
+    CHECK(2U == ds_trace.pin_errors);
+    CHECK(0U == ds_trace.parked_mask);
+}
+#endif /* APP_DSRAM_TRACE_ENABLE */
+
+
+int main(void)
+{
+    test_ds_callback_modes();
+    test_dsram_callback_modes();
+    test_hal_calls_per_transition();
+    test_register_callbacks();
+    test_syspm_init_order();
+#if (APP_DSRAM_TRACE_ENABLE)
+    test_trace_transitions();
+    test_trace_order_error();
+    test_trace_pin_symmetry();
+#endif /* APP_DSRAM_TRACE_ENABLE */
+
+    printf("test_app_dsram (APP_DSRAM_TRACE_ENABLE=%u): %u checks, "
+           "%u failures\n", (unsigned)APP_DSRAM_TRACE_ENABLE,
+           (unsigned)test_checks, (unsigned)test_failures);
+    return (0U == test_failures) ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+################################################################################
+# \file log_decode.py
+# \version 1.0
+#
+# \brief
+# Host decoder for the tokenized application log (APP_LOG_TOKENIZED=1).
+# Rebuilds the text from the binary frames sent on the debug UART using the
+# token dictionary in app_log_tokens.h.
+#
+# Frame layout: 0xC0, token varint, one varint per argument. Varints are
+# LEB128, 7 bits per byte, least significant group first.
+#
+# When the log is enabled the firmware also sends a dictionary frame: 0xC1,
+# token count varint, dictionary hash varint. The decoder warns if these do
+# not match the dictionary it was given. The hash covers the token count and
+# the argument count and format string size of each token.
+#
+# Usage:
+#   python3 log_decode.py [--dict app_log_tokens.h] [capture.bin]
+#   python3 log_decode.py --port COM5 [--baud 115200]
+#   python3 log_decode.py --dump
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import codecs
+import json
+import os
+import re
+import sys
+
+FRAME_SYNC = 0xC0
+FRAME_DICT = 0xC1
+
+# FNV-1a, folded over 32-bit values, as in app_log.c
+HASH_SEED = 2166136261
+HASH_PRIME = 16777619
+
+DEFAULT_DICT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            os.pardir, "app_log_tokens.h")
+
+# X(name, argc, "literal" "literal" ...)
+ENTRY_RE = re.compile(r'X\(\s*(\w+)\s*,\s*(\d+)\s*,((?:\s*"(?:[^"\\]|\\.)*")+)\s*\)')
+LITERAL_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+
+
+def load_dictionary(path):
+    """Returns a list of (name, argc, format) indexed by token value."""
+    with open(path, "r", encoding="utf-8") as header:
+        text = header.read()
+
+    # Join the macro continuation lines of the token list
+    text = text.replace("\\\n", " ")
+
+    tokens = []
+    for match in ENTRY_RE.finditer(text):
+        literal = "".join(LITERAL_RE.findall(match.group(3)))
+        fmt = codecs.decode(literal, "unicode_escape")
+        tokens.append((match.group(1), int(match.group(2)), fmt))
+    if not tokens:
+        sys.exit("No log tokens found in " + path)
+    return tokens
+
+
+def dictionary_hash(tokens):
+    """Same hash as app_log_dict_hash() in app_log.c."""
+    value = ((HASH_SEED ^ len(tokens)) * HASH_PRIME) & 0xFFFFFFFF
+    for _, argc, fmt in tokens:
+        size = len(fmt.encode("latin-1")) + 1
+        value = ((value ^ argc) * HASH_PRIME) & 0xFFFFFFFF
+        value = ((value ^ size) * HASH_PRIME) & 0xFFFFFFFF
+    return value
+
+
+def check_dictionary(stream, tokens):
+    """Reads the rest of a dictionary frame and warns on mismatch."""
+    count = read_varint(stream)
+    value = read_varint(stream)
+    if count is None or value is None:
+        return
+    expected = dictionary_hash(tokens)
+    if count != len(tokens) or value != expected:
+        sys.stderr.write(
+            "WARNING: firmware log dictionary (%d tokens, hash 0x%08X) does "
+            "not match %d tokens, hash 0x%08X from the given app_log_tokens.h; "
+            "decoded text may be wrong\n" % (count, value, len(tokens),
+                                            expected))
+        sys.stderr.flush()
+
+
+def read_varint(stream):
+    """Reads one varint, returns None at end of stream."""
+    value = 0
+    shift = 0
+    while True:
+        byte = stream.read(1)
+        if not byte:
+            return None
+        value |= (byte[0] & 0x7F) << shift
+        if byte[0] < 0x80:
+            return value
+        shift += 7
+        if shift > 28:
+            raise ValueError("varint too long")
+
+
+def decode(stream, tokens, out):
+    """Decodes frames until end of stream, skipping bytes outside a frame."""
+    while True:
+        byte = stream.read(1)
+        if not byte:
+            return
+        if byte[0] == FRAME_DICT:
+            try:
+                check_dictionary(stream, tokens)
+            except ValueError as error:
+                out.write("<%s>\n" % error)
+            continue
+        if byte[0] != FRAME_SYNC:
+            continue
+        try:
+            token = read_varint(stream)
+            if token is None:
+                return
+            if token >= len(tokens):
+                out.write("<unknown token %d>\n" % token)
+                continue
+            _, argc, fmt = tokens[token]
+            args = []
+            for _ in range(argc):
+                value = read_varint(stream)
+                if value is None:
+                    return
+                args.append(value)
+        except ValueError as error:
+            out.write("<%s>\n" % error)
+            continue
+        out.write(fmt % tuple(args) if argc else fmt.replace("%%", "%"))
+        out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode the tokenized application log")
+    parser.add_argument("input", nargs="?",
+                        help="binary capture, standard input if omitted")
+    parser.add_argument("--dict", default=DEFAULT_DICT,
+                        help="path to app_log_tokens.h")
+    parser.add_argument("--port", help="serial port to read from (pyserial)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--dump", action="store_true",
+                        help="print the dictionary as JSON and exit")
+    args = parser.parse_args()
+
+    tokens = load_dictionary(args.dict)
+
+    if args.dump:
+        sys.stderr.write("%d tokens, hash 0x%08X\n"
+                         % (len(tokens), dictionary_hash(tokens)))
+        json.dump([{"token": index, "name": name, "argc": argc, "format": fmt}
+                   for index, (name, argc, fmt) in enumerate(tokens)],
+                  sys.stdout, indent=2)
+        sys.stdout.write("\n")
+        return
+
+    if args.port:
+        import serial
+        stream = serial.Serial(args.port, args.baud)
+    elif args.input:
+        stream = open(args.input, "rb")
+    else:
+        stream = sys.stdin.buffer
+
+    with stream:
+        decode(stream, tokens, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,806 @@
+/*******************************************************************************
+* File Name:   power_sim.c
+
+* Description: Host power/latency simulator for the CYW20829 power modes.
+*              Replays an event trace against a set of mode selection
+*              policies in the LP and ULP system states and prints the
+*              energy and response time of each, marking the Pareto-optimal
+*              ones in each system state.
+*
+*              Build:  cc -O2 -o power_sim tools/power_sim.c -lm
+*              Run:    ./power_sim -c tools/power_calibration.txt -n 1000000
+*                      ./power_sim -c tools/power_calibration.txt -t trace.txt
+*
+*              Trace format: one event per line, "<arrival us> [<busy us>]",
+*              arrivals in increasing order. Lines starting with '#' are
+*              skipped.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2021-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Response time histogram: 1 us bins, the last bin collects everything
+ * above. A p99 that falls in the last bin is reported as saturated. */
+#define SIM_HIST_BINS             (65536U)
+
+#define SIM_MAX_POLICIES          (64U)
+
+/* Timeouts swept by the timeout policies, in us */
+#define SIM_TIMEOUT_COUNT         (7U)
+
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+/* Same order as enum PowerModes in main.c */
+typedef enum
+{
+    SIM_ACTIVE = 0U,
+    SIM_SLEEP,
+    SIM_DEEPSLEEP,
+    SIM_DEEPSLEEP_RAM,
+    SIM_HIBERNATE,
+    SIM_MODE_COUNT
+} sim_mode_t;
+
+typedef enum
+{
+    SIM_SYSTEM_LP = 0U,
+    SIM_SYSTEM_ULP,
+    SIM_SYSTEM_COUNT
+} sim_system_t;
+
+typedef enum
+{
+    SIM_POLICY_CURRENT = 0U,    /* switch_power_mode(): one selected mode */
+    SIM_POLICY_TIMEOUT,         /* Sleep, then a deeper mode after a timeout */
+    SIM_POLICY_ORACLE,          /* Lowest energy mode for the known gap */
+} sim_policy_kind_t;
+
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    double current_ua[SIM_SYSTEM_COUNT];
+    double entry_us;
+    double exit_us;
+    double transition_uaus;     /* Transition energy as uA x us */
+} sim_mode_cal_t;
+
+typedef struct
+{
+    double voltage;
+    double ulp_slowdown;
+    sim_mode_cal_t mode[SIM_MODE_COUNT];
+    double wakeup_active_us[SIM_MODE_COUNT];    /* Current policy only */
+} sim_cal_t;
+
+typedef struct
+{
+    double arrival_us;
+    double busy_us;
+} sim_event_t;
+
+typedef struct
+{
+    sim_policy_kind_t kind;
+    sim_mode_t mode;            /* Selected or deep mode */
+    double timeout_us;
+} sim_policy_t;
+
+typedef struct
+{
+    sim_system_t system;
+    sim_policy_t policy;
+    double energy_uj;
+    double duration_us;
+    double mean_response_us;
+    uint32_t p99_response_us;
+    bool p99_saturated;         /* p99 is at least SIM_HIST_BINS - 1 us */
+    double max_response_us;     /* Tracked outside the histogram */
+    bool pareto;
+} sim_result_t;
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char * const sim_mode_names[SIM_MODE_COUNT] =
+{
+    "active", "sleep", "deepsleep", "deepsleep_ram", "hibernate"
+};
+
+static const char * const sim_system_names[SIM_SYSTEM_COUNT] =
+{
+    "LP", "ULP"
+};
+
+static const double sim_timeouts_us[SIM_TIMEOUT_COUNT] =
+{
+    100.0, 1000.0, 10000.0, 100000.0, 1000000.0, 10000000.0, 100000000.0
+};
+
+static uint32_t sim_hist[SIM_HIST_BINS];
+
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: sim_load_calibration
+********************************************************************************
+* Summary:
+*  Reads the calibration file described in tools/power_calibration.txt
+*
+* Return:
+*  true on success, false if the file cannot be read or is incomplete
+*
+*******************************************************************************/
+static bool sim_load_calibration(const char *path, sim_cal_t *cal)
+{
+    FILE *file = fopen(path, "r");
+    char line[256];
+    char name[32];
+    uint32_t seen = 0;
+    uint32_t index;
+    sim_mode_cal_t mode;
+    double transition_uj;
+    double active_us;
+
+    if (NULL == file)
+    {
+        fprintf(stderr, "Cannot open calibration file %s\n", path);
+        return false;
+    }
+
+    memset(cal, 0, sizeof(*cal));
+    cal->voltage = 3.0;
+    cal->ulp_slowdown = 1.0;
+
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        if (1 == sscanf(line, " voltage %lf", &cal->voltage) ||
+            1 == sscanf(line, " ulp_slowdown %lf", &cal->ulp_slowdown))
+        {
+            continue;
+        }
+        if (2 == sscanf(line, " wakeup_active %31s %lf", name, &active_us))
+        {
+            for (index = 0; index < SIM_MODE_COUNT; index++)
+            {
+                if (0 == strcmp(name, sim_mode_names[index]))
+                {
+                    cal->wakeup_active_us[index] = active_us;
+                    break;
+                }
+            }
+        }
+        else if (6 == sscanf(line, " mode %31s %lf %lf %lf %lf %lf", name,
+                             &mode.current_ua[SIM_SYSTEM_LP],
+                             &mode.current_ua[SIM_SYSTEM_ULP],
+                             &mode.entry_us, &mode.exit_us, &transition_uj))
+        {
+            mode.transition_uaus = transition_uj;
+            for (index = 0; index < SIM_MODE_COUNT; index++)
+            {
+                if (0 == strcmp(name, sim_mode_names[index]))
+                {
+                    cal->mode[index] = mode;
+                    seen |= (1UL << index);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            continue;
+        }
+        if (SIM_MODE_COUNT == index)
+        {
+            fprintf(stderr, "Unknown mode %s in %s\n", name, path);
+        }
+    }
+    fclose(file);
+
+    if (seen != ((1UL << SIM_MODE_COUNT) - 1U))
+    {
+        fprintf(stderr, "%s must define all %u modes\n", path,
+                (unsigned)SIM_MODE_COUNT);
+        return false;
+    }
+
+    /* Transition energy was read in uJ; uJ = uA x V x us x 1e-6 */
+    for (index = 0; index < SIM_MODE_COUNT; index++)
+    {
+        cal->mode[index].transition_uaus =
+            cal->mode[index].transition_uaus / (cal->voltage * 1e-6);
+    }
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_load_trace
+********************************************************************************
+* Summary:
+*  Reads a recorded event trace. Events without a busy time use busy_us.
+*
+* Return:
+*  Number of events read, 0 on error. *events must be freed by the caller.
+*
+*******************************************************************************/
+static size_t sim_load_trace(const char *path, double busy_us,
+                             sim_event_t **events)
+{
+    FILE *file = fopen(path, "r");
+    char line[128];
+    size_t count = 0;
+    size_t capacity = 1024;
+    sim_event_t *list;
+    sim_event_t *grown;
+    char *end;
+
+    if (NULL == file)
+    {
+        fprintf(stderr, "Cannot open trace file %s\n", path);
+        return 0;
+    }
+
+    list = malloc(capacity * sizeof(*list));
+    while ((NULL != list) && (NULL != fgets(line, sizeof(line), file)))
+    {
+        if (('#' == line[0]) || ('\n' == line[0]))
+        {
+            continue;
+        }
+        if (count == capacity)
+        {
+            capacity *= 2U;
+            grown = realloc(list, capacity * sizeof(*list));
+            if (NULL == grown)
+            {
+                free(list);
+                list = NULL;
+                break;
+            }
+            list = grown;
+        }
+        list[count].arrival_us = strtod(line, &end);
+        list[count].busy_us = strtod(end, &end);
+        if (0.0 == list[count].busy_us)
+        {
+            list[count].busy_us = busy_us;
+        }
+        count++;
+    }
+    fclose(file);
+
+    if (NULL == list)
+    {
+        fprintf(stderr, "Out of memory reading %s\n", path);
+        return 0;
+    }
+    *events = list;
+    return count;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+* Summary:
+*  xorshift64* generator, returns a value in (0, 1]
+*
+*******************************************************************************/
+static double sim_random(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return ((double)((*state * 2685821657736338717ULL) >> 11) + 1.0) *
+           (1.0 / 9007199254740992.0);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_make_trace
+********************************************************************************
+* Summary:
+*  Generates Poisson arrivals with the given mean gap and a fixed busy time
+*
+* Return:
+*  Number of events, 0 on error. *events must be freed by the caller.
+*
+*******************************************************************************/
+static size_t sim_make_trace(size_t count, double mean_gap_us, double busy_us,
+                             uint64_t seed, sim_event_t **events)
+{
+    sim_event_t *list = malloc(count * sizeof(*list));
+    uint64_t state = (0U != seed) ? seed : 1U;
+    double now = 0.0;
+    size_t index;
+
+    if (NULL == list)
+    {
+        fprintf(stderr, "Out of memory generating %zu events\n", count);
+        return 0;
+    }
+    for (index = 0; index < count; index++)
+    {
+        now += -mean_gap_us * log(sim_random(&state));
+        list[index].arrival_us = now;
+        list[index].busy_us = busy_us;
+    }
+    *events = list;
+    return count;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_idle_cost
+********************************************************************************
+* Summary:
+*  Energy (uA x us) of spending an idle gap in one mode and the latency seen
+*  by the event that ends the gap. Entry and exit run at the active current.
+*  An event that arrives during entry waits for the entry to complete.
+*
+*******************************************************************************/
+static double sim_idle_cost(const sim_cal_t *cal, sim_system_t system,
+                            sim_mode_t mode, double gap_us, double *latency_us)
+{
+    const sim_mode_cal_t *m = &cal->mode[mode];
+    double active_ua = cal->mode[SIM_ACTIVE].current_ua[system];
+    double wait_us = 0.0;
+    double charge;
+
+    if (SIM_ACTIVE == mode)
+    {
+        *latency_us = 0.0;
+        return active_ua * gap_us;
+    }
+
+    if (gap_us >= m->entry_us)
+    {
+        charge = (active_ua * m->entry_us) +
+                 (m->current_ua[system] * (gap_us - m->entry_us));
+    }
+    else
+    {
+        /* The event has to wait for the entry to complete */
+        charge = active_ua * gap_us;
+        wait_us = m->entry_us - gap_us;
+    }
+
+    *latency_us = wait_us + m->exit_us;
+    return charge + (active_ua * (*latency_us)) + m->transition_uaus;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_policy_cost
+********************************************************************************
+* Summary:
+*  Energy (uA x us) and latency of an idle gap under a policy
+*
+*******************************************************************************/
+static double sim_policy_cost(const sim_cal_t *cal, sim_system_t system,
+                              const sim_policy_t *policy, double gap_us,
+                              double *latency_us)
+{
+    const sim_mode_cal_t *sleep = &cal->mode[SIM_SLEEP];
+    double best;
+    double charge;
+    double latency;
+    uint32_t mode;
+
+    switch (policy->kind)
+    {
+        case SIM_POLICY_TIMEOUT:
+            if (gap_us <= policy->timeout_us)
+            {
+                return sim_idle_cost(cal, system, SIM_SLEEP, gap_us,
+                                     latency_us);
+            }
+            /* Sleep residency up to the timeout, then the deep mode */
+            charge = (cal->mode[SIM_ACTIVE].current_ua[system] *
+                      sleep->entry_us) +
+                     (sleep->current_ua[system] *
+                      fmax(policy->timeout_us - sleep->entry_us, 0.0));
+            return charge + sim_idle_cost(cal, system, policy->mode,
+                                          gap_us - policy->timeout_us,
+                                          latency_us);
+
+        case SIM_POLICY_ORACLE:
+            best = sim_idle_cost(cal, system, SIM_ACTIVE, gap_us, latency_us);
+            for (mode = SIM_SLEEP; mode < SIM_MODE_COUNT; mode++)
+            {
+                charge = sim_idle_cost(cal, system, (sim_mode_t)mode, gap_us,
+                                       &latency);
+                if (charge < best)
+                {
+                    best = charge;
+                    *latency_us = latency;
+                }
+            }
+            return best;
+
+        default:
+            return sim_idle_cost(cal, system, policy->mode, gap_us,
+                                 latency_us);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+*  Replays the trace under one policy. Events are served in arrival order;
+*  an event that arrives while the previous one is still busy waits for it
+*  without the device going idle. The response time of an event is its
+*  wait, the wakeup latency, and its busy time, which is slowed down in the
+*  ULP state.
+*
+*  Under the current policy, the device also stays active for the calibrated
+*  wakeup_active time after each event, printing the transition messages.
+*  An event that arrives meanwhile is served at once, the printing goes on
+*  in the background.
+*
+*******************************************************************************/
+static void sim_run(const sim_cal_t *cal, const sim_event_t *events,
+                    size_t count, sim_result_t *result)
+{
+    double active_ua = cal->mode[SIM_ACTIVE].current_ua[result->system];
+    double slowdown = (SIM_SYSTEM_ULP == result->system) ?
+                      cal->ulp_slowdown : 1.0;
+    double wakeup_active_us = (SIM_POLICY_CURRENT == result->policy.kind) ?
+                              cal->wakeup_active_us[result->policy.mode] : 0.0;
+    double charge = 0.0;
+    double free_at = 0.0;
+    double awake_until = 0.0;
+    double response_sum = 0.0;
+    double latency;
+    double response;
+    double overlap;
+    double start;
+    double busy;
+    uint64_t target;
+    uint64_t seen = 0;
+    uint32_t bin;
+    size_t index;
+
+    memset(sim_hist, 0, sizeof(sim_hist));
+    result->max_response_us = 0.0;
+
+    for (index = 0; index < count; index++)
+    {
+        busy = events[index].busy_us * slowdown;
+        if (events[index].arrival_us <= awake_until)
+        {
+            /* Still active: wait for the previous event, if any. Active time
+             * still left from the previous wakeup is not charged twice. */
+            start = fmax(events[index].arrival_us, free_at);
+            latency = start - events[index].arrival_us;
+            overlap = fmin(fmax(awake_until - start, 0.0), busy);
+            charge += active_ua * (busy - overlap);
+        }
+        else
+        {
+            charge += sim_policy_cost(cal, result->system, &result->policy,
+                                      events[index].arrival_us - awake_until,
+                                      &latency);
+            start = events[index].arrival_us + latency;
+            charge += active_ua * busy;
+        }
+        free_at = start + busy;
+        awake_until = fmax(awake_until, free_at) + wakeup_active_us;
+        charge += active_ua * wakeup_active_us;
+
+        response = latency + busy;
+        response_sum += response;
+        bin = (response >= (double)(SIM_HIST_BINS - 1U)) ?
+              (SIM_HIST_BINS - 1U) : (uint32_t)response;
+        sim_hist[bin]++;
+        result->max_response_us = fmax(result->max_response_us, response);
+    }
+
+    result->energy_uj = charge * cal->voltage * 1e-6;
+    result->duration_us = awake_until;
+    result->mean_response_us = (0U != count) ? (response_sum / count) : 0.0;
+
+    /* 99th percentile from the histogram */
+    target = ((uint64_t)count * 99U + 99U) / 100U;
+    for (bin = 0; bin < SIM_HIST_BINS; bin++)
+    {
+        seen += sim_hist[bin];
+        if (seen >= target)
+        {
+            break;
+        }
+    }
+    result->p99_response_us = (bin < SIM_HIST_BINS) ? bin : SIM_HIST_BINS - 1U;
+    result->p99_saturated = (result->p99_response_us == (SIM_HIST_BINS - 1U));
+}
+
+
+/*******************************************************************************
+* Function Name: sim_mark_pareto
+********************************************************************************
+* Summary:
+*  Marks the results not dominated in both average power and p99 response
+*  time. Called once per system state, so that the LP and ULP fronts are
+*  both reported. Saturated p99 values compare as equal, check the
+*  p99_saturated column before relying on the front.
+*
+*******************************************************************************/
+static void sim_mark_pareto(sim_result_t *results, size_t count)
+{
+    size_t i;
+    size_t j;
+    double power_i;
+    double power_j;
+
+    for (i = 0; i < count; i++)
+    {
+        results[i].pareto = true;
+        power_i = results[i].energy_uj / results[i].duration_us;
+        for (j = 0; (j < count) && results[i].pareto; j++)
+        {
+            power_j = results[j].energy_uj / results[j].duration_us;
+            if ((j != i) &&
+                (power_j <= power_i) &&
+                (results[j].p99_response_us <= results[i].p99_response_us) &&
+                ((power_j < power_i) ||
+                 (results[j].p99_response_us < results[i].p99_response_us)))
+            {
+                results[i].pareto = false;
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_policy_name
+********************************************************************************
+* Summary:
+*  Formats a policy as it is printed in the result table
+*
+*******************************************************************************/
+static void sim_policy_name(const sim_policy_t *policy, char *buf, size_t len)
+{
+    switch (policy->kind)
+    {
+        case SIM_POLICY_TIMEOUT:
+            snprintf(buf, len, "timeout:%s:%.0fus", sim_mode_names[policy->mode],
+                     policy->timeout_us);
+            break;
+        case SIM_POLICY_ORACLE:
+            snprintf(buf, len, "oracle");
+            break;
+        default:
+            snprintf(buf, len, "current:%s", sim_mode_names[policy->mode]);
+            break;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_usage
+*******************************************************************************/
+static void sim_usage(const char *name)
+{
+    fprintf(stderr,
+        "Usage: %s -c <calibration> [-t <trace> | -n <events>] [options]\n"
+        "  -c file   calibration file (see tools/power_calibration.txt)\n"
+        "  -t file   recorded trace, \"<arrival us> [<busy us>]\" per line\n"
+        "  -n count  synthetic trace length (default 1000000)\n"
+        "  -m us     synthetic mean gap between events (default 1000000)\n"
+        "  -b us     busy time per event (default 500)\n"
+        "  -s seed   synthetic trace seed (default 1)\n", name);
+}
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Sweeps every policy in both system states and prints one CSV row per run
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    const char *cal_path = NULL;
+    const char *trace_path = NULL;
+    size_t count = 1000000U;
+    double mean_gap_us = 1000000.0;
+    double busy_us = 500.0;
+    uint64_t seed = 1U;
+    sim_cal_t cal;
+    sim_event_t *events = NULL;
+    sim_policy_t policies[SIM_MAX_POLICIES];
+    sim_result_t results[SIM_MAX_POLICIES * SIM_SYSTEM_COUNT];
+    size_t policy_count = 0;
+    size_t result_count = 0;
+    size_t index;
+    uint32_t mode;
+    uint32_t timeout;
+    uint32_t system;
+    char name[48];
+    clock_t start;
+    double seconds;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((arg + 1) >= argc)
+        {
+            sim_usage(argv[0]);
+            return 1;
+        }
+        if (0 == strcmp(argv[arg], "-c"))
+        {
+            cal_path = argv[++arg];
+        }
+        else if (0 == strcmp(argv[arg], "-t"))
+        {
+            trace_path = argv[++arg];
+        }
+        else if (0 == strcmp(argv[arg], "-n"))
+        {
+            count = strtoull(argv[++arg], NULL, 0);
+        }
+        else if (0 == strcmp(argv[arg], "-m"))
+        {
+            mean_gap_us = strtod(argv[++arg], NULL);
+        }
+        else if (0 == strcmp(argv[arg], "-b"))
+        {
+            busy_us = strtod(argv[++arg], NULL);
+        }
+        else if (0 == strcmp(argv[arg], "-s"))
+        {
+            seed = strtoull(argv[++arg], NULL, 0);
+        }
+        else
+        {
+            sim_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((NULL == cal_path) || !sim_load_calibration(cal_path, &cal))
+    {
+        sim_usage(argv[0]);
+        return 1;
+    }
+
+    count = (NULL != trace_path) ?
+            sim_load_trace(trace_path, busy_us, &events) :
+            sim_make_trace(count, mean_gap_us, busy_us, seed, &events);
+    if (0U == count)
+    {
+        return 1;
+    }
+
+    /* Today's policy: stay in the mode selected with User Button 1. Only the
+     * modes the application stays in across wakeups are simulated: a
+     * DeepSleep-RAM wakeup moves on to Hibernate, and Hibernate is only woken
+     * by User Button 1 and restarts in Active. */
+    for (mode = SIM_ACTIVE; mode <= SIM_DEEPSLEEP; mode++)
+    {
+        policies[policy_count].kind = SIM_POLICY_CURRENT;
+        policies[policy_count].mode = (sim_mode_t)mode;
+        policies[policy_count].timeout_us = 0.0;
+        policy_count++;
+    }
+    for (mode = SIM_DEEPSLEEP; mode < SIM_MODE_COUNT; mode++)
+    {
+        for (timeout = 0; timeout < SIM_TIMEOUT_COUNT; timeout++)
+        {
+            policies[policy_count].kind = SIM_POLICY_TIMEOUT;
+            policies[policy_count].mode = (sim_mode_t)mode;
+            policies[policy_count].timeout_us = sim_timeouts_us[timeout];
+            policy_count++;
+        }
+    }
+    policies[policy_count].kind = SIM_POLICY_ORACLE;
+    policies[policy_count].mode = SIM_ACTIVE;
+    policies[policy_count].timeout_us = 0.0;
+    policy_count++;
+
+    start = clock();
+    for (system = 0; system < SIM_SYSTEM_COUNT; system++)
+    {
+        for (index = 0; index < policy_count; index++)
+        {
+            results[result_count].system = (sim_system_t)system;
+            results[result_count].policy = policies[index];
+            sim_run(&cal, events, count, &results[result_count]);
+            result_count++;
+        }
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    for (system = 0; system < SIM_SYSTEM_COUNT; system++)
+    {
+        sim_mark_pareto(&results[system * policy_count], policy_count);
+    }
+
+    printf("system,policy,avg_power_uW,energy_mJ,mean_response_us,"
+           "p99_response_us,p99_saturated,max_response_us,pareto\n");
+    for (index = 0; index < result_count; index++)
+    {
+        sim_policy_name(&results[index].policy, name, sizeof(name));
+        printf("%s,%s,%.3f,%.3f,%.1f,%lu,%d,%.1f,%d\n",
+               sim_system_names[results[index].system], name,
+               results[index].energy_uj / results[index].duration_us * 1e6,
+               results[index].energy_uj * 1e-3,
+               results[index].mean_response_us,
+               (unsigned long)results[index].p99_response_us,
+               results[index].p99_saturated ? 1 : 0,
+               results[index].max_response_us,
+               results[index].pareto ? 1 : 0);
+    }
+
+    fprintf(stderr, "%zu events x %zu runs in %.2f s (%.1f M events/s)\n",
+            count, result_count, seconds,
+            (seconds > 0.0) ? (count * result_count) / seconds * 1e-6 : 0.0);
+
+    free(events);
+    return 0;
+}
+
+
+/* [] END OF FILE */